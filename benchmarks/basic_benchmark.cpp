@@ -25,14 +25,14 @@ static void BM_OrderListAdd(benchmark::State& state)
     uint64_t order_id = 0;
     bool side_state = false;
     uint64_t quantity = 1;
-    double price = 0.0;
+    Price price = 0;
 
     for (auto _ : state)
     {
         for(int i = 1; i <= state.range(0); ++i)
         {
             orders.add(order_id++, (side_state ? OrderSide::BUY : OrderSide::SELL), quantity++, price);
-            price += 0.01;
+            price += 100;
             side_state = !side_state;
         }
     }
@@ -47,12 +47,12 @@ static void BM_OrderListModify(benchmark::State& state)
     uint64_t order_id = 0;
     bool side_state = false;
     uint64_t quantity = 1;
-    double price = 0.01;
+    Price price = 100;
 
     for(int i = 1; i <= state.range(0); ++i)
     {
         orders.add(order_id++, (side_state ? OrderSide::BUY : OrderSide::SELL), quantity++, price);
-        price += 0.01;
+        price += 100;
         side_state = !side_state;
     }
 
@@ -60,13 +60,13 @@ static void BM_OrderListModify(benchmark::State& state)
     {
         order_id = 0;
         quantity = 2;
-        price = 0.02;
+        price = 200;
 
         for(int i = 1; i <= state.range(0); ++i)
         {
             orders.modify(order_id++, quantity, price);
             quantity += 2;
-            price += 0.02;
+            price += 200;
         }
     }
 }
@@ -82,12 +82,12 @@ static void BM_OrderListCancel(benchmark::State& state)
         uint64_t order_id = 0;
         bool side_state = false;
         uint64_t quantity = 1;
-        double price = 0.01;
+        Price price = 100;
 
         for(int i = 1; i <= state.range(0); ++i)
         {
             orders.add(order_id++, (side_state ? OrderSide::BUY : OrderSide::SELL), quantity++, price);
-            price += 0.01;
+            price += 100;
             side_state = !side_state;
         }
 
@@ -108,12 +108,12 @@ static void BM_OrderListVwap(benchmark::State& state)
     uint64_t order_id = 0;
     bool side_state = false;
     uint64_t quantity = 1;
-    double price = 0.0;
+    Price price = 0;
 
     for(int i = 1; i <= state.range(0); ++i)
     {
         orders.add(order_id++, (side_state ? OrderSide::BUY : OrderSide::SELL), quantity++, price);
-        price += 0.01;
+        price += 100;
         side_state = !side_state;
     }
 
@@ -134,12 +134,12 @@ static void BM_OrderListBbo(benchmark::State& state)
     uint64_t order_id = 0;
     bool side_state = false;
     uint64_t quantity = 1;
-    double price = 0.0;
+    Price price = 0;
 
     for(int i = 1; i <= state.range(0); ++i)
     {
         orders.add(order_id++, (side_state ? OrderSide::BUY : OrderSide::SELL), quantity++, price);
-        price += 0.01;
+        price += 100;
         side_state = !side_state;
     }
 
@@ -0,0 +1,131 @@
+//
+//  tokenizer_benchmark.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 05.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "split.hpp"
+#include "tokenizer.hpp"
+#include "line_reader.hpp"
+#include "delimiter_scanner.hpp"
+
+using namespace std;
+using namespace md::tokenizers;
+
+/******************************* Helpers ******************************/
+
+namespace
+{
+
+/**
+ * Generates the feed with the realistic mix of commands
+ * @param lines number of lines to generate
+ * @return feed
+ */
+string MakeFeed(int64_t lines)
+{
+    string feed;
+
+    for (int64_t i = 0; i < lines; ++i)
+    {
+        switch (i % 4)
+        {
+            case 0:
+            case 1:
+                feed += "ORDER ADD," + to_string(1000 + i) + ",AAPL,Buy,100,72.82\n";
+                break;
+            case 2:
+                feed += "ORDER MODIFY," + to_string(1000 + i - 2) + ",50,72.81\n";
+                break;
+            default:
+                feed += "ORDER CANCEL," + to_string(1000 + i - 3) + "\n";
+                break;
+        }
+    }
+
+    return feed;
+}
+
+} // namespace
+
+/***************************** Benchmarks *****************************/
+
+static void BM_TokenizeLegacySplit(benchmark::State& state)
+{
+    const string feed = MakeFeed(state.range(0));
+
+    for (auto _ : state)
+    {
+        md::readers::ForEachLine(feed, [](string_view line)
+        {
+            auto tokens = split(string(line), ',');
+            benchmark::DoNotOptimize(tokens);
+        });
+    }
+
+    state.SetBytesProcessed(state.iterations() * feed.size());
+}
+
+BENCHMARK(BM_TokenizeLegacySplit)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(1<<10, 16<<10);
+
+static void BM_TokenizeMemchr(benchmark::State& state)
+{
+    const string feed = MakeFeed(state.range(0));
+    TokenList tokens;
+
+    for (auto _ : state)
+    {
+        md::readers::ForEachLine(feed, [&tokens](string_view line)
+        {
+            Tokenize(line, ',', tokens);
+            benchmark::DoNotOptimize(tokens);
+        });
+    }
+
+    state.SetBytesProcessed(state.iterations() * feed.size());
+}
+
+BENCHMARK(BM_TokenizeMemchr)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(1<<10, 16<<10);
+
+static void BM_TokenizeBlock(benchmark::State& state)
+{
+    const string feed = MakeFeed(state.range(0));
+    BlockTokenizer tokenizer;
+
+    for (auto _ : state)
+    {
+        tokenizer.forEachLine(feed, [](string_view, const TokenList &tokens)
+        {
+            benchmark::DoNotOptimize(tokens);
+        });
+    }
+
+    state.SetBytesProcessed(state.iterations() * feed.size());
+}
+
+BENCHMARK(BM_TokenizeBlock)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(1<<10, 16<<10);
+
+static void BM_ScanDelimiters(benchmark::State& state)
+{
+    const string feed = MakeFeed(16<<10);
+    const ScanLevel level = static_cast<ScanLevel>(state.range(0));
+    vector<uint32_t> positions(feed.size());
+
+    for (auto _ : state)
+    {
+        auto count = ScanDelimiters(level, feed.data(), feed.size(), positions.data());
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * feed.size());
+}
+
+BENCHMARK(BM_ScanDelimiters)->Unit(benchmark::kMicrosecond)->DenseRange(SCAN_SCALAR, SCAN_AVX2);
@@ -9,7 +9,6 @@
 #include "bbo_subscription_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -18,7 +17,7 @@ using namespace md::tokenizers;
 
 
 BboSubscriptionData::BboSubscriptionData(const string &command) :
-    symbol_(""),
+    symbol_(),
     command_(command)
 {
 }
@@ -39,42 +38,29 @@ BboSubscriptionData & BboSubscriptionData::operator=(const BboSubscriptionData &
     return *this;
 }
 
-void BboSubscriptionData::processTokens(const vector<string> &tokens)
+void BboSubscriptionData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != BboSubscriptionIndex::SIZE)
     {
-        if (tokens.size() != BboSubscriptionIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != command_)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        symbol_ = tokens.at(BboSubscriptionIndex::SYMBOL);
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != command_)
     {
-        cerr << "BboSubscriptionData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    symbol_ = tokens[BboSubscriptionIndex::SYMBOL];
+
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
-const string & BboSubscriptionData::getSymbol()
+string_view BboSubscriptionData::getSymbol()
 {
     return symbol_;
 }
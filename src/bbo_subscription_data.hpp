@@ -10,6 +10,8 @@
 #define bbo_subscription_data_hpp
 
 //System includes
+#include <string>
+#include <string_view>
 
 //Local includes
 #include "md_command_data.hpp"
@@ -55,16 +57,16 @@ public:
 
     /**
      * Implements the operation to process all of the tokens for Bbo Subscription command
-     * @param tokens vector of the tokens for SB and UB commands
+     * @param tokens list of the tokens for SB and UB commands
      */
-    virtual void processTokens(const vector<string> &tokens) override;
+    virtual void processTokens(const TokenList &tokens) override;
 
     /** Returns current symbol */
-    const string & getSymbol();
+    string_view getSymbol();
 
 protected:
-    /** Holds stock symbol. Can't be empty string */
-    string symbol_;
+    /** Holds stock symbol. Can't be empty string. Points in to the tokenized line */
+    string_view symbol_;
 
     /** Holds the current command name */
     string command_;
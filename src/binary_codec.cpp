@@ -0,0 +1,219 @@
+//
+//  binary_codec.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "binary_codec.hpp"
+
+//System includes
+#include <cstring>
+#include <iostream>
+
+//Local includes
+#include "md_command_data.hpp"
+
+using namespace std;
+using namespace md::binary;
+using namespace md::tokenizers;
+using md::processors::MdProcessor;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Text names of the commands. Indexed by BinaryCommand */
+const char * const COMMAND_NAMES[CMD_COUNT] =
+{
+    "",
+    "ORDER ADD",
+    "ORDER MODIFY",
+    "ORDER CANCEL",
+    "SUBSCRIBE BBO",
+    "UNSUBSCRIBE BBO",
+    "SUBSCRIBE VWAP",
+    "UNSUBSCRIBE VWAP",
+    "PRINT",
+    "PRINT_FULL"
+};
+
+//Binary commands follow the decoded command types one to one
+static_assert(static_cast<int>(CMD_NONE) == static_cast<int>(COMMAND_INVALID), "Command mismatch");
+static_assert(static_cast<int>(CMD_ORDER_ADD) == static_cast<int>(COMMAND_ORDER_ADD), "Command mismatch");
+static_assert(static_cast<int>(CMD_PRINT_FULL) == static_cast<int>(COMMAND_PRINT_FULL), "Command mismatch");
+
+/**
+ * Is used to print the fixed point price without the trailing zeros
+ * @param price in ticks
+ * @return text representation
+ */
+string FormatPrice(Price price)
+{
+    string result;
+
+    uint64_t ticks = static_cast<uint64_t>(price);
+
+    if (price < 0)
+    {
+        result += '-';
+        ticks = 0 - ticks;
+    }
+
+    result += to_string(ticks / PRICE_SCALE);
+
+    uint64_t fraction = ticks % PRICE_SCALE;
+
+    if (fraction != 0)
+    {
+        int decimals = PRICE_DECIMALS;
+
+        while (fraction % 10 == 0)
+        {
+            fraction /= 10;
+            --decimals;
+        }
+
+        string digits = to_string(fraction);
+        result += '.';
+        result.append(decimals - digits.size(), '0');
+        result += digits;
+    }
+
+    return result;
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+bool md::binary::EncodeTokens(const TokenList &tokens, MdDecoder &decoder,
+                              BinaryWriter &writer, BinaryRecord &record)
+{
+    if (tokens.empty())
+    {
+        cerr << "EncodeTokens(): Provided array of tokens is empty. Ignoring" << '\n';
+        return false;
+    }
+
+    MdCommand command;
+
+    if (!decoder.decode(string_view(), tokens, command))
+    {
+        if (decoder.failedType() == COMMAND_INVALID)
+        {
+            cerr << "EncodeTokens(): Unknown command [" << tokens[MdCommandData::COMMAND_NAME] << "]" << '\n';
+        }
+        else
+        {
+            cerr << "EncodeTokens(): Tokens were not processed successfully. Reason: ["
+                << decoder.errorMessage() << "]" << '\n';
+        }
+
+        return false;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.command = static_cast<uint8_t>(command.type);
+    record.side = static_cast<uint8_t>(command.side);
+    record.order_id = command.order_id;
+    record.quantity = command.quantity;
+    record.price = command.price;
+
+    if (!command.symbol.empty())
+    {
+        record.symbol_id = writer.symbolId(command.symbol);
+    }
+
+    return true;
+}
+
+bool md::binary::ReplayRecord(const BinaryRecord &record, const BinaryFeed &feed, MdProcessor &processor)
+{
+    switch (record.command)
+    {
+        case CMD_ORDER_MODIFY:
+            return processor.orderModify(record.order_id, record.quantity, record.price);
+        case CMD_ORDER_CANCEL:
+            return processor.orderCancel(record.order_id);
+        default:
+            break;
+    }
+
+    if (record.symbol_id >= feed.symbolCount())
+    {
+        cout << "ReplayRecord(): Unknown symbol id [" << record.symbol_id << "]" << '\n';
+        return false;
+    }
+
+    const string_view symbol = feed.symbol(record.symbol_id);
+
+    switch (record.command)
+    {
+        case CMD_ORDER_ADD:
+            if (record.side != OrderSide::BUY && record.side != OrderSide::SELL)
+            {
+                cout << "ReplayRecord(): Bad order side [" << static_cast<int>(record.side) << "]" << '\n';
+                return false;
+            }
+
+            return processor.orderAdd(record.order_id, symbol, static_cast<OrderSide>(record.side),
+                                      record.quantity, record.price);
+        case CMD_SUBSCRIBE_BBO:
+            return processor.subscribeBbo(symbol);
+        case CMD_UNSUBSCRIBE_BBO:
+            return processor.unsubscribeBbo(symbol);
+        case CMD_SUBSCRIBE_VWAP:
+            return processor.subscribeVwap(symbol, record.quantity);
+        case CMD_UNSUBSCRIBE_VWAP:
+            return processor.unsubscribeVwap(symbol, record.quantity);
+        case CMD_PRINT:
+            return processor.print(symbol);
+        case CMD_PRINT_FULL:
+            return processor.printFull(symbol);
+        default:
+            cout << "ReplayRecord(): Unknown command [" << static_cast<int>(record.command) << "]" << '\n';
+            return false;
+    }
+}
+
+string md::binary::RecordToLine(const BinaryRecord &record, const BinaryFeed &feed)
+{
+    if (record.command == CMD_NONE || record.command >= CMD_COUNT)
+    {
+        return "<unknown command " + to_string(record.command) + ">";
+    }
+
+    string line = COMMAND_NAMES[record.command];
+
+    const string symbol = (record.symbol_id < feed.symbolCount())
+        ? string(feed.symbol(record.symbol_id))
+        : "<unknown symbol " + to_string(record.symbol_id) + ">";
+
+    switch (record.command)
+    {
+        case CMD_ORDER_ADD:
+            line += ',' + to_string(record.order_id) + ',' + symbol;
+            line += (record.side == OrderSide::SELL) ? ",Sell," : ",Buy,";
+            line += to_string(record.quantity) + ',' + FormatPrice(record.price);
+            break;
+        case CMD_ORDER_MODIFY:
+            line += ',' + to_string(record.order_id) + ',' + to_string(record.quantity)
+                + ',' + FormatPrice(record.price);
+            break;
+        case CMD_ORDER_CANCEL:
+            line += ',' + to_string(record.order_id);
+            break;
+        case CMD_SUBSCRIBE_VWAP:
+        case CMD_UNSUBSCRIBE_VWAP:
+            line += ',' + symbol + ',' + to_string(record.quantity);
+            break;
+        default:
+            line += ',' + symbol;
+            break;
+    }
+
+    return line;
+}
@@ -0,0 +1,65 @@
+//
+//  binary_codec.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef binary_codec_hpp
+#define binary_codec_hpp
+
+//System includes
+#include <string>
+
+//Local includes
+#include "binary_format.hpp"
+#include "tokenizer.hpp"
+#include "md_decoder.hpp"
+#include "md_processor.hpp"
+
+namespace md
+{
+namespace binary
+{
+
+using namespace std;
+using md::tokenizers::TokenList;
+using md::tokenizers::MdDecoder;
+
+/**
+ * Is used to convert the tokens of one text command in to the binary record.
+ * Tokens are validated exactly as the processor does it, the reason of the
+ * failure is reported to the stderr
+ * @param tokens of the text command
+ * @param decoder is used to validate the tokens
+ * @param writer is used to intern the symbol
+ * @param record where to store the result
+ * @return true if the tokens were converted, false otherwise
+ */
+bool EncodeTokens(const TokenList &tokens, MdDecoder &decoder,
+                  BinaryWriter &writer, BinaryRecord &record);
+
+/**
+ * Is used to execute the binary record on the processor. No tokenizing or
+ * number parsing is involved
+ * @param record what to execute
+ * @param feed where the record came from. Is used to resolve the symbol
+ * @param processor what to execute the record on
+ * @return true if the processing was successfull false otherwise
+ */
+bool ReplayRecord(const BinaryRecord &record, const BinaryFeed &feed, md::processors::MdProcessor &processor);
+
+/**
+ * Is used to reconstruct the text command from the binary record. Numbers are
+ * printed in the canonical form, so the result may differ from the original line
+ * @param record what to convert
+ * @param feed where the record came from. Is used to resolve the symbol
+ * @return text command
+ */
+string RecordToLine(const BinaryRecord &record, const BinaryFeed &feed);
+
+} // namespace binary
+} // namespace md
+
+#endif /* binary_codec_hpp */
@@ -0,0 +1,234 @@
+//
+//  binary_format.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "binary_format.hpp"
+
+//System includes
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+//Local includes
+
+using namespace std;
+using namespace md::binary;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/**
+ * Is used to get the header with all the fields but the counters filled in
+ * @return header
+ */
+FileHeader MakeHeader()
+{
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FEED_MAGIC, sizeof(header.magic));
+    header.version = FEED_VERSION;
+    header.record_size = sizeof(BinaryRecord);
+    return header;
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+bool md::binary::IsBinaryFeed(string_view data)
+{
+    return data.size() >= sizeof(FEED_MAGIC) && memcmp(data.data(), FEED_MAGIC, sizeof(FEED_MAGIC)) == 0;
+}
+
+/**************************** BinaryWriter ****************************/
+
+BinaryWriter::BinaryWriter() :
+    record_count_(0)
+{
+}
+
+BinaryWriter::~BinaryWriter()
+{
+    if (out_.is_open())
+    {
+        close();
+    }
+}
+
+bool BinaryWriter::open(const string &filename)
+{
+    out_.open(filename, ios::binary | ios::trunc);
+
+    if (!out_.is_open())
+    {
+        return false;
+    }
+
+    symbol_ids_.clear();
+    symbols_.clear();
+    record_count_ = 0;
+
+    //Counters are patched on close
+    const FileHeader header = MakeHeader();
+    out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    return out_.good();
+}
+
+uint32_t BinaryWriter::symbolId(string_view symbol)
+{
+    auto result = symbol_ids_.emplace(string(symbol), static_cast<uint32_t>(symbols_.size()));
+
+    if (result.second)
+    {
+        symbols_.emplace_back(symbol);
+    }
+
+    return result.first->second;
+}
+
+void BinaryWriter::write(const BinaryRecord &record)
+{
+    out_.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    ++record_count_;
+}
+
+bool BinaryWriter::close()
+{
+    FileHeader header = MakeHeader();
+    header.record_count = record_count_;
+    header.symbol_table_offset = sizeof(FileHeader) + record_count_ * sizeof(BinaryRecord);
+    header.symbol_count = static_cast<uint32_t>(symbols_.size());
+
+    for (const auto &symbol : symbols_)
+    {
+        if (symbol.size() > numeric_limits<uint16_t>::max())
+        {
+            cerr << "BinaryWriter::close(): Symbol is too long [" << symbol << "]" << '\n';
+            out_.close();
+            return false;
+        }
+
+        const uint16_t length = static_cast<uint16_t>(symbol.size());
+        out_.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        out_.write(symbol.data(), length);
+    }
+
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    const bool result = out_.good();
+    out_.close();
+
+    return result;
+}
+
+uint64_t BinaryWriter::recordCount() const
+{
+    return record_count_;
+}
+
+size_t BinaryWriter::symbolCount() const
+{
+    return symbols_.size();
+}
+
+/***************************** BinaryFeed *****************************/
+
+BinaryFeed::BinaryFeed() :
+    records_(nullptr),
+    record_count_(0)
+{
+}
+
+bool BinaryFeed::open(string_view data)
+{
+    records_ = nullptr;
+    record_count_ = 0;
+    symbols_.clear();
+
+    if (!IsBinaryFeed(data) || data.size() < sizeof(FileHeader))
+    {
+        cerr << "BinaryFeed::open(): Not a binary feed" << '\n';
+        return false;
+    }
+
+    FileHeader header;
+    memcpy(&header, data.data(), sizeof(header));
+
+    if (header.version != FEED_VERSION || header.record_size != sizeof(BinaryRecord))
+    {
+        cerr << "BinaryFeed::open(): Unsupported feed version [" << header.version << "]" << '\n';
+        return false;
+    }
+
+    const uint64_t records_size = (data.size() - sizeof(FileHeader)) / sizeof(BinaryRecord);
+
+    if (header.record_count > records_size
+        || header.symbol_table_offset != sizeof(FileHeader) + header.record_count * sizeof(BinaryRecord))
+    {
+        cerr << "BinaryFeed::open(): Truncated or corrupted feed" << '\n';
+        return false;
+    }
+
+    symbols_.reserve(header.symbol_count);
+
+    size_t offset = header.symbol_table_offset;
+
+    for (uint32_t i = 0; i < header.symbol_count; ++i)
+    {
+        uint16_t length = 0;
+
+        if (data.size() - offset < sizeof(length))
+        {
+            cerr << "BinaryFeed::open(): Truncated symbol table" << '\n';
+            return false;
+        }
+
+        memcpy(&length, data.data() + offset, sizeof(length));
+        offset += sizeof(length);
+
+        if (data.size() - offset < length)
+        {
+            cerr << "BinaryFeed::open(): Truncated symbol table" << '\n';
+            return false;
+        }
+
+        symbols_.push_back(data.substr(offset, length));
+        offset += length;
+    }
+
+    records_ = data.data() + sizeof(FileHeader);
+    record_count_ = header.record_count;
+
+    return true;
+}
+
+size_t BinaryFeed::size() const
+{
+    return record_count_;
+}
+
+BinaryRecord BinaryFeed::record(size_t index) const
+{
+    //Mapping is not guaranteed to be aligned for the record, copy is free anyway
+    BinaryRecord result;
+    memcpy(&result, records_ + index * sizeof(BinaryRecord), sizeof(result));
+    return result;
+}
+
+size_t BinaryFeed::symbolCount() const
+{
+    return symbols_.size();
+}
+
+string_view BinaryFeed::symbol(uint32_t id) const
+{
+    return symbols_[id];
+}
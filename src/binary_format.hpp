@@ -0,0 +1,253 @@
+//
+//  binary_format.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef binary_format_hpp
+#define binary_format_hpp
+
+//System includes
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+#include "price.hpp"
+
+namespace md
+{
+namespace binary
+{
+
+using namespace std;
+
+/**
+ * Layout of the binary feed (all numbers are in the host byte order):
+ *
+ *   FileHeader
+ *   BinaryRecord * record_count
+ *   symbol table: symbol_count * ([uint16_t length][length bytes])
+ *
+ * Symbol table is written last, so the converter can stream the records
+ * without knowing all the symbols in advance. Header points to it.
+ */
+
+/** Magic which starts every binary feed */
+const char FEED_MAGIC[8] = {'M', 'D', 'R', 'B', 'I', 'N', '\0', '\x1a'};
+
+/** Current version of the format */
+const uint32_t FEED_VERSION = 1;
+
+/** Commands of the binary record. Zero is never written */
+enum BinaryCommand
+{
+    CMD_NONE,
+    CMD_ORDER_ADD,
+    CMD_ORDER_MODIFY,
+    CMD_ORDER_CANCEL,
+    CMD_SUBSCRIBE_BBO,
+    CMD_UNSUBSCRIBE_BBO,
+    CMD_SUBSCRIBE_VWAP,
+    CMD_UNSUBSCRIBE_VWAP,
+    CMD_PRINT,
+    CMD_PRINT_FULL,
+    CMD_COUNT
+};
+
+/** Header of the binary feed */
+struct FileHeader
+{
+    /** Always FEED_MAGIC */
+    char magic[8];
+
+    /** Format version. Always FEED_VERSION */
+    uint32_t version;
+
+    /** Size of one record. Always sizeof(BinaryRecord) */
+    uint32_t record_size;
+
+    /** Number of the records which follow the header */
+    uint64_t record_count;
+
+    /** Offset of the symbol table from the start of the file */
+    uint64_t symbol_table_offset;
+
+    /** Number of the entries in the symbol table */
+    uint32_t symbol_count;
+
+    /** Not used. Always zero */
+    uint32_t reserved;
+};
+
+/**
+ * Fixed width record of one command. Fields which the command does not have
+ * are zero. Symbol is carried as the index in the symbol table.
+ */
+struct BinaryRecord
+{
+    /** One of BinaryCommand */
+    uint8_t command;
+
+    /** OrderSide for the Order Add, zero otherwise */
+    uint8_t side;
+
+    /** Not used. Always zero */
+    uint16_t reserved;
+
+    /** Index in the symbol table */
+    uint32_t symbol_id;
+
+    /** Order id for the order commands */
+    uint64_t order_id;
+
+    /** Order quantity or the vwap quantity */
+    uint64_t quantity;
+
+    /** Order price in the fixed point ticks */
+    Price price;
+};
+
+static_assert(sizeof(FileHeader) == 40, "FileHeader layout must not change");
+static_assert(sizeof(BinaryRecord) == 32, "BinaryRecord layout must not change");
+
+/**
+ * Is used to check whether or not the buffer starts with the binary feed magic
+ * @param data content of the file
+ * @return true if it looks like the binary feed
+ */
+bool IsBinaryFeed(string_view data);
+
+/**
+ * Binary feed writer. Records are streamed to the file as they come, symbols
+ * are interned and written with the header patch on close.
+ */
+class BinaryWriter
+{
+public:
+    /** Default constructor */
+    BinaryWriter();
+
+    /** Destructor. Finishes the file if it is still open */
+    ~BinaryWriter();
+
+    /**
+     * Is used to create the output file. Placeholder header is written
+     * @param filename path to the file to be created
+     * @return true if the file was created, false otherwise
+     */
+    bool open(const string &filename);
+
+    /**
+     * Is used to get the id of the symbol. New symbols are added to the table
+     * @param symbol to look up
+     * @return index of the symbol in the table
+     */
+    uint32_t symbolId(string_view symbol);
+
+    /**
+     * Is used to append the record to the file
+     * @param record what to write
+     */
+    void write(const BinaryRecord &record);
+
+    /**
+     * Writes the symbol table and the final header, closes the file
+     * @return true if everything was written successfully
+     */
+    bool close();
+
+    /**
+     * Is used to get the number of the records written so far
+     * @return number of the records
+     */
+    uint64_t recordCount() const;
+
+    /**
+     * Is used to get the number of the symbols interned so far
+     * @return number of the symbols
+     */
+    size_t symbolCount() const;
+
+private:
+    /** Output file */
+    ofstream out_;
+
+    /** Symbol to its id */
+    unordered_map<string, uint32_t> symbol_ids_;
+
+    /** Symbols in the id order */
+    vector<string> symbols_;
+
+    /** Number of the records written */
+    uint64_t record_count_;
+
+    PREVENT_COPY(BinaryWriter);
+    PREVENT_MOVE(BinaryWriter);
+};
+
+/**
+ * Read only view on the binary feed. Does not own the memory, is meant to be
+ * used on top of the mapped file.
+ */
+class BinaryFeed
+{
+public:
+    /** Default constructor */
+    BinaryFeed();
+
+    /**
+     * Is used to validate the header and load the symbol table
+     * @param data whole content of the file. Must outlive the object
+     * @return true if the feed is valid, false otherwise
+     */
+    bool open(string_view data);
+
+    /**
+     * Is used to get the number of the records in the feed
+     * @return number of the records
+     */
+    size_t size() const;
+
+    /**
+     * Is used to get the record by its index
+     * @param index of the record. Must be less than size()
+     * @return copy of the record
+     */
+    BinaryRecord record(size_t index) const;
+
+    /**
+     * Is used to get the number of the symbols in the table
+     * @return number of the symbols
+     */
+    size_t symbolCount() const;
+
+    /**
+     * Is used to get the symbol by its id
+     * @param id of the symbol. Must be less than symbolCount()
+     * @return symbol. Points in to the feed memory
+     */
+    string_view symbol(uint32_t id) const;
+
+private:
+    /** First record */
+    const char *records_;
+
+    /** Number of the records */
+    size_t record_count_;
+
+    /** Symbol table. Point in to the feed memory */
+    vector<string_view> symbols_;
+};
+
+} // namespace binary
+} // namespace md
+
+#endif /* binary_format_hpp */
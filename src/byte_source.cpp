@@ -0,0 +1,398 @@
+//
+//  byte_source.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 10.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "byte_source.hpp"
+
+//System includes
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+#include <zlib.h>
+
+#ifdef MD_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+//Local includes
+
+using namespace std;
+using namespace md::readers;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Number of the bytes enough to detect any supported compression */
+const size_t MAGIC_SIZE = 4;
+
+/** Size of the compressed input buffer of the decoders */
+const size_t COMPRESSED_CHUNK = 256 * 1024;
+
+/**
+ * Plain file descriptor. Bytes which were read ahead to detect the compression
+ * are returned first
+ */
+class DescriptorSource : public ByteSource
+{
+public:
+    /**
+     * Constructor
+     * @param fd descriptor to read from
+     * @param owns_fd if set the descriptor is closed in the destructor
+     * @param prefix bytes which were already read from the descriptor
+     */
+    DescriptorSource(int fd, bool owns_fd, string prefix) :
+        fd_(fd),
+        owns_fd_(owns_fd),
+        prefix_(move(prefix)),
+        prefix_offset_(0)
+    {
+    }
+
+    /** Destructor. Closes the owned descriptor */
+    virtual ~DescriptorSource()
+    {
+        if (owns_fd_)
+        {
+            ::close(fd_);
+        }
+    }
+
+    virtual ssize_t read(char *data, size_t size) override
+    {
+        if (prefix_offset_ < prefix_.size())
+        {
+            const size_t count = min(size, prefix_.size() - prefix_offset_);
+            memcpy(data, prefix_.data() + prefix_offset_, count);
+            prefix_offset_ += count;
+            return static_cast<ssize_t>(count);
+        }
+
+        for (;;)
+        {
+            const ssize_t result = ::read(fd_, data, size);
+
+            if (result >= 0 || errno != EINTR)
+            {
+                return result;
+            }
+        }
+    }
+
+private:
+    /** Descriptor to read from */
+    int fd_;
+
+    /** Is set if the descriptor has to be closed */
+    bool owns_fd_;
+
+    /** Bytes which were read ahead */
+    string prefix_;
+
+    /** Number of the prefix bytes already returned */
+    size_t prefix_offset_;
+};
+
+/**
+ * Streaming gzip decoder. Concatenated gzip members are decoded one after
+ * another, as gzip -d does it
+ */
+class GzipSource : public ByteSource
+{
+public:
+    /**
+     * Constructor
+     * @param input compressed bytes
+     */
+    explicit GzipSource(unique_ptr<ByteSource> input) :
+        input_(move(input)),
+        buffer_(COMPRESSED_CHUNK),
+        member_open_(false),
+        finished_(false)
+    {
+        memset(&stream_, 0, sizeof(stream_));
+
+        //32 - detect the gzip header automatically
+        if (inflateInit2(&stream_, 15 + 32) != Z_OK)
+        {
+            throw bad_alloc();
+        }
+    }
+
+    /** Destructor. Releases the decoder state */
+    virtual ~GzipSource()
+    {
+        inflateEnd(&stream_);
+    }
+
+    virtual ssize_t read(char *data, size_t size) override
+    {
+        if (finished_)
+        {
+            return 0;
+        }
+
+        const uInt capacity = static_cast<uInt>(min<size_t>(size, UINT_MAX));
+
+        stream_.next_out = reinterpret_cast<Bytef *>(data);
+        stream_.avail_out = capacity;
+
+        while (stream_.avail_out == capacity)
+        {
+            if (stream_.avail_in == 0)
+            {
+                const ssize_t count = input_->read(buffer_.data(), buffer_.size());
+
+                if (count < 0)
+                {
+                    return -1;
+                }
+
+                if (count == 0)
+                {
+                    if (member_open_)
+                    {
+                        cerr << "GzipSource::read(): Compressed input is truncated" << '\n';
+                        return -1;
+                    }
+
+                    finished_ = true;
+                    break;
+                }
+
+                stream_.next_in = reinterpret_cast<Bytef *>(buffer_.data());
+                stream_.avail_in = static_cast<uInt>(count);
+            }
+
+            member_open_ = true;
+
+            const int result = inflate(&stream_, Z_NO_FLUSH);
+
+            if (result == Z_STREAM_END)
+            {
+                //Next member may follow
+                inflateReset(&stream_);
+                member_open_ = false;
+            }
+            else if (result != Z_OK && result != Z_BUF_ERROR)
+            {
+                cerr << "GzipSource::read(): Corrupted compressed input ["
+                    << (stream_.msg ? stream_.msg : "unknown error") << "]" << '\n';
+                return -1;
+            }
+        }
+
+        return static_cast<ssize_t>(capacity - stream_.avail_out);
+    }
+
+private:
+    /** Compressed bytes */
+    unique_ptr<ByteSource> input_;
+
+    /** Compressed input buffer */
+    vector<char> buffer_;
+
+    /** Decoder state */
+    z_stream stream_;
+
+    /** Is set while the gzip member is not decoded completely */
+    bool member_open_;
+
+    /** Is set once all the members were decoded */
+    bool finished_;
+};
+
+#ifdef MD_HAVE_ZSTD
+
+/** Streaming zstd decoder. Concatenated frames are decoded one after another */
+class ZstdSource : public ByteSource
+{
+public:
+    /**
+     * Constructor
+     * @param input compressed bytes
+     */
+    explicit ZstdSource(unique_ptr<ByteSource> input) :
+        input_(move(input)),
+        buffer_(COMPRESSED_CHUNK),
+        stream_(ZSTD_createDStream()),
+        in_{buffer_.data(), 0, 0},
+        frame_open_(false),
+        finished_(false)
+    {
+        if (stream_ == nullptr)
+        {
+            throw bad_alloc();
+        }
+
+        ZSTD_initDStream(stream_);
+    }
+
+    /** Destructor. Releases the decoder state */
+    virtual ~ZstdSource()
+    {
+        ZSTD_freeDStream(stream_);
+    }
+
+    virtual ssize_t read(char *data, size_t size) override
+    {
+        if (finished_)
+        {
+            return 0;
+        }
+
+        ZSTD_outBuffer out = {data, size, 0};
+
+        while (out.pos == 0)
+        {
+            if (in_.pos == in_.size)
+            {
+                const ssize_t count = input_->read(buffer_.data(), buffer_.size());
+
+                if (count < 0)
+                {
+                    return -1;
+                }
+
+                if (count == 0)
+                {
+                    if (frame_open_)
+                    {
+                        cerr << "ZstdSource::read(): Compressed input is truncated" << '\n';
+                        return -1;
+                    }
+
+                    finished_ = true;
+                    break;
+                }
+
+                in_.size = static_cast<size_t>(count);
+                in_.pos = 0;
+            }
+
+            const size_t result = ZSTD_decompressStream(stream_, &out, &in_);
+
+            if (ZSTD_isError(result))
+            {
+                cerr << "ZstdSource::read(): Corrupted compressed input ["
+                    << ZSTD_getErrorName(result) << "]" << '\n';
+                return -1;
+            }
+
+            //Zero means the frame is complete and flushed
+            frame_open_ = (result != 0);
+        }
+
+        return static_cast<ssize_t>(out.pos);
+    }
+
+private:
+    /** Compressed bytes */
+    unique_ptr<ByteSource> input_;
+
+    /** Compressed input buffer */
+    vector<char> buffer_;
+
+    /** Decoder state */
+    ZSTD_DStream *stream_;
+
+    /** Position in the compressed input buffer */
+    ZSTD_inBuffer in_;
+
+    /** Is set while the zstd frame is not decoded completely */
+    bool frame_open_;
+
+    /** Is set once all the frames were decoded */
+    bool finished_;
+};
+
+#endif //MD_HAVE_ZSTD
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+Compression md::readers::DetectCompression(string_view prefix)
+{
+    if (prefix.size() >= 2 && prefix[0] == '\x1f' && prefix[1] == '\x8b')
+    {
+        return COMPRESSION_GZIP;
+    }
+
+    if (prefix.size() >= 4 && prefix.substr(0, 4) == string_view("\x28\xb5\x2f\xfd", 4))
+    {
+        return COMPRESSION_ZSTD;
+    }
+
+    return COMPRESSION_NONE;
+}
+
+bool md::readers::IsCompressionSupported(Compression compression)
+{
+    switch (compression)
+    {
+        case COMPRESSION_NONE:
+        case COMPRESSION_GZIP:
+            return true;
+        case COMPRESSION_ZSTD:
+#ifdef MD_HAVE_ZSTD
+            return true;
+#else
+            return false;
+#endif
+    }
+
+    return false;
+}
+
+unique_ptr<ByteSource> md::readers::OpenByteSource(int fd, bool owns_fd)
+{
+    //Pipes may return the magic in pieces
+    string prefix(MAGIC_SIZE, '\0');
+    size_t filled = 0;
+
+    while (filled < MAGIC_SIZE)
+    {
+        const ssize_t result = ::read(fd, &prefix[filled], MAGIC_SIZE - filled);
+
+        if (result > 0)
+        {
+            filled += static_cast<size_t>(result);
+        }
+        else if (result == 0 || errno != EINTR)
+        {
+            break;
+        }
+    }
+
+    prefix.resize(filled);
+
+    const Compression compression = DetectCompression(prefix);
+
+    unique_ptr<ByteSource> source = make_unique<DescriptorSource>(fd, owns_fd, move(prefix));
+
+    switch (compression)
+    {
+        case COMPRESSION_GZIP:
+            return make_unique<GzipSource>(move(source));
+        case COMPRESSION_ZSTD:
+#ifdef MD_HAVE_ZSTD
+            return make_unique<ZstdSource>(move(source));
+#else
+            cerr << "OpenByteSource(): zstd input is not supported by this build" << '\n';
+            return nullptr;
+#endif
+        default:
+            return source;
+    }
+}
@@ -0,0 +1,90 @@
+//
+//  byte_source.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 10.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef byte_source_hpp
+#define byte_source_hpp
+
+//System includes
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+
+//Local includes
+#include "defines.h"
+
+namespace md
+{
+namespace readers
+{
+
+using namespace std;
+
+/** Compression of the input. Is detected from the magic bytes */
+enum Compression
+{
+    COMPRESSION_NONE,
+    COMPRESSION_GZIP,
+    COMPRESSION_ZSTD
+};
+
+/**
+ * Is used to detect the compression from the first bytes of the input
+ * @param prefix first bytes of the input. Four bytes are enough
+ * @return detected compression
+ */
+Compression DetectCompression(string_view prefix);
+
+/**
+ * Is used to check whether or not the compression can be decoded by this build
+ * @param compression to check
+ * @return true if supported
+ */
+bool IsCompressionSupported(Compression compression);
+
+/**
+ * Sequential source of the bytes. Is used by the reading thread to fill the
+ * buffers, so the decompression runs there too.
+ */
+class ByteSource
+{
+public:
+    /** Default constructor */
+    ByteSource() = default;
+
+    /** Default destructor */
+    virtual ~ByteSource() = default;
+
+    /**
+     * Is used to read the next portion of the bytes. Blocks until something is
+     * available
+     * @param data where to store the bytes
+     * @param size capacity of the data
+     * @return number of the bytes stored, 0 at the end of the input, -1 on error
+     */
+    virtual ssize_t read(char *data, size_t size) = 0;
+
+private:
+    PREVENT_COPY(ByteSource);
+    PREVENT_MOVE(ByteSource);
+};
+
+/**
+ * Is used to open the source on top of the file descriptor. First bytes are
+ * read to detect the compression and the matching decoder is stacked on top
+ * @param fd descriptor to read from
+ * @param owns_fd if set the descriptor is closed together with the source
+ * @return source. Null if the compression is not supported by this build
+ */
+unique_ptr<ByteSource> OpenByteSource(int fd, bool owns_fd);
+
+} // namespace readers
+} // namespace md
+
+#endif /* byte_source_hpp */
@@ -17,31 +17,47 @@
 
 //Local includes
 #include "order_request.hpp"
+#include "symbol_table.hpp"
+#include "order_id_table.hpp"
+#include "order_pool.hpp"
 
 using namespace std;
 
 //Forward declarations
+class SymbolOrderList;
 
 //Definitions
 
 /**
  * Enumeration to distinguish between Buy and Sell orders.
- * Is used to make the connection between OrderIdMap and OrderSet*Ptr's
+ * Is used to make the connection between OrderIdMap and the book sides
  */
-enum OrderSide
+enum OrderSide : uint8_t
 {
     UNKNOWN,
     BUY,
     SELL
 };
 
-/** Multiset (greater) pointer definition for the convinience */
-using OrderSetGreaterPtr = shared_ptr<multiset<OrderRequest, greater<OrderRequest>>>;
+/** Set definition to take track on the existing order ids */
+using OrderIdMap = OrderIdTable<pair<OrderSide, OrderRef>>;
 
-/** Multiset (less) pointer definition for the convinience */
-using OrderSetLessPtr = shared_ptr<multiset<OrderRequest, less<OrderRequest>>>;
+/**
+ * Everything needed to reach the live order without looking it up by id.
+ * The order list is the one of the symbol. Order references are not
+ * changed by the other inserts and erases, so the handle stays valid
+ * until the order is modified or canceled
+ */
+struct OrderHandle
+{
+    /** Order in the book of its side */
+    OrderRef order;
 
-/** Set definition to take track on the existing order ids */
-using OrderIdMap = unordered_map<uint64_t, pair<OrderSide, multiset<OrderRequest>::iterator>>;
+    /** Symbol of the order */
+    SymbolId symbol;
+
+    /** Side of the order */
+    OrderSide side;
+};
 
 #endif //_CONTAINERDEFINITIONS_H
\ No newline at end of file
@@ -0,0 +1,210 @@
+//
+//  delimiter_scanner.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 05.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "delimiter_scanner.hpp"
+
+//System includes
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MD_SCANNER_X86
+#endif
+
+//Local includes
+
+using namespace std;
+using namespace md::tokenizers;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Scan implementation definition */
+using ScanFunction = size_t (*)(const char *, size_t, uint32_t *);
+
+/**
+ * Byte by byte implementation. Is used for the tails and on the CPUs
+ * without the vector extensions
+ * @param data start of the block
+ * @param size size of the block
+ * @param positions where to store the offsets
+ * @param offset is added to every stored position
+ * @return number of the offsets stored
+ */
+size_t ScanScalar(const char *data, size_t size, uint32_t *positions, size_t offset)
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const char c = data[i];
+
+        if (c == ',' || c == '\n')
+        {
+            positions[count++] = static_cast<uint32_t>(offset + i);
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Converts the bit mask of the found delimiters in to the offsets
+ * @param mask one bit per byte of the vector
+ * @param base offset of the vector in the block
+ * @param positions where to store the offsets
+ * @return number of the offsets stored
+ */
+inline size_t FlattenMask(uint32_t mask, size_t base, uint32_t *positions)
+{
+    size_t count = 0;
+
+    while (mask != 0)
+    {
+        positions[count++] = static_cast<uint32_t>(base + __builtin_ctz(mask));
+        mask &= mask - 1;
+    }
+
+    return count;
+}
+
+size_t ScanScalarBlock(const char *data, size_t size, uint32_t *positions)
+{
+    return ScanScalar(data, size, positions, 0);
+}
+
+#ifdef MD_SCANNER_X86
+
+/**
+ * SSE2 implementation. 16 bytes at once
+ * @param data start of the block
+ * @param begin offset in the block where to start the scan
+ * @param size size of the block
+ * @param positions where to store the offsets
+ * @return number of the offsets stored
+ */
+__attribute__((target("sse2")))
+size_t ScanSse2Range(const char *data, size_t begin, size_t size, uint32_t *positions)
+{
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    size_t count = 0;
+    size_t i = begin;
+
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, comma),
+                                           _mm_cmpeq_epi8(chunk, newline));
+
+        count += FlattenMask(static_cast<uint32_t>(_mm_movemask_epi8(found)), i, positions + count);
+    }
+
+    return count + ScanScalar(data + i, size - i, positions + count, i);
+}
+
+size_t ScanSse2Block(const char *data, size_t size, uint32_t *positions)
+{
+    return ScanSse2Range(data, 0, size, positions);
+}
+
+/** AVX2 implementation. 64 bytes per iteration, the tail goes through SSE2 */
+__attribute__((target("avx2")))
+size_t ScanAvx2Block(const char *data, size_t size, uint32_t *positions)
+{
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i newline = _mm256_set1_epi8('\n');
+
+    size_t count = 0;
+    size_t i = 0;
+
+    for (; i + 64 <= size; i += 64)
+    {
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + 32));
+
+        const __m256i found_low = _mm256_or_si256(_mm256_cmpeq_epi8(low, comma),
+                                                  _mm256_cmpeq_epi8(low, newline));
+        const __m256i found_high = _mm256_or_si256(_mm256_cmpeq_epi8(high, comma),
+                                                   _mm256_cmpeq_epi8(high, newline));
+
+        count += FlattenMask(static_cast<uint32_t>(_mm256_movemask_epi8(found_low)), i, positions + count);
+        count += FlattenMask(static_cast<uint32_t>(_mm256_movemask_epi8(found_high)), i + 32, positions + count);
+    }
+
+    return count + ScanSse2Range(data, i, size, positions + count);
+}
+
+#endif //MD_SCANNER_X86
+
+/**
+ * Is used to check which instruction set is supported by the running CPU
+ * @return best supported scan level
+ */
+ScanLevel DetectLevel()
+{
+#ifdef MD_SCANNER_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SCAN_AVX2;
+    }
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return SCAN_SSE2;
+    }
+#endif
+
+    return SCAN_SCALAR;
+}
+
+/**
+ * Is used to get the implementation for the scan level
+ * @param level requested scan level
+ * @return implementation. Unsupported levels are lowered to the supported one
+ */
+ScanFunction SelectScanner(ScanLevel level)
+{
+    level = min(level, DetectScanLevel());
+
+    switch (level)
+    {
+#ifdef MD_SCANNER_X86
+        case SCAN_AVX2:
+            return ScanAvx2Block;
+        case SCAN_SSE2:
+            return ScanSse2Block;
+#endif
+        default:
+            return ScanScalarBlock;
+    }
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+ScanLevel md::tokenizers::DetectScanLevel()
+{
+    static const ScanLevel level = DetectLevel();
+    return level;
+}
+
+size_t md::tokenizers::ScanDelimiters(const char *data, size_t size, uint32_t *positions)
+{
+    static const ScanFunction scanner = SelectScanner(DetectScanLevel());
+    return scanner(data, size, positions);
+}
+
+size_t md::tokenizers::ScanDelimiters(ScanLevel level, const char *data, size_t size, uint32_t *positions)
+{
+    return SelectScanner(level)(data, size, positions);
+}
@@ -0,0 +1,191 @@
+//
+//  delimiter_scanner.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 05.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef delimiter_scanner_hpp
+#define delimiter_scanner_hpp
+
+//System includes
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+//Local includes
+#include "defines.h"
+#include "tokenizer.hpp"
+
+namespace md
+{
+namespace tokenizers
+{
+
+using namespace std;
+
+/** Instruction set used to look for the delimiters */
+enum ScanLevel
+{
+    SCAN_SCALAR,
+    SCAN_SSE2,
+    SCAN_AVX2
+};
+
+/**
+ * Is used to get the best instruction set supported by the running CPU
+ * @return scan level which ScanDelimiters() dispatches to
+ */
+ScanLevel DetectScanLevel();
+
+/**
+ * Finds the positions of all of the ',' and '\n' characters in the block.
+ * Dispatches to the best implementation supported by the running CPU
+ * @param data start of the block
+ * @param size size of the block. Must fit in to uint32_t
+ * @param positions where to store the offsets. Must have room for size entries
+ * @return number of the offsets stored
+ */
+size_t ScanDelimiters(const char *data, size_t size, uint32_t *positions);
+
+/**
+ * Same as above but with the explicit implementation. Levels not supported
+ * by the running CPU fall back to the best supported one
+ * @param level which implementation to use
+ * @param data start of the block
+ * @param size size of the block. Must fit in to uint32_t
+ * @param positions where to store the offsets. Must have room for size entries
+ * @return number of the offsets stored
+ */
+size_t ScanDelimiters(ScanLevel level, const char *data, size_t size, uint32_t *positions);
+
+/**
+ * Splits the contiguous buffer in to the lines and the lines in to the tokens
+ * in one pass. The buffer is scanned window by window for the delimiters, then
+ * the lines are put together from the found offsets without looking at the
+ * bytes again. Follows the ForEachLine() and Tokenize() semantics.
+ */
+class BlockTokenizer
+{
+public:
+    /** Default size of the window scanned at once. Fits the L2 cache */
+    static constexpr size_t DEFAULT_WINDOW = 64 * 1024;
+
+    /**
+     * Constructor
+     * @param window number of bytes scanned at once
+     */
+    explicit BlockTokenizer(size_t window = DEFAULT_WINDOW) :
+        window_(max<size_t>(window, 1))
+    {
+    }
+
+    /** Default destructor */
+    ~BlockTokenizer() = default;
+
+    /**
+     * Iterates through the lines of the buffer. Empty lines are skipped
+     * @param buffer what to split
+     * @param handler callable with (string_view line, const TokenList &tokens)
+     */
+    template<typename Handler>
+    void forEachLine(string_view buffer, Handler handler);
+
+private:
+    /** Number of bytes scanned at once */
+    size_t window_;
+
+    /** Offsets of the delimiters in the current window */
+    vector<uint32_t> positions_;
+
+    /** Tokens of the current line */
+    TokenList tokens_;
+
+    PREVENT_COPY(BlockTokenizer);
+    PREVENT_MOVE(BlockTokenizer);
+};
+
+template<typename Handler>
+void BlockTokenizer::forEachLine(string_view buffer, Handler handler)
+{
+    const char *data = buffer.data();
+    const size_t total = buffer.size();
+    size_t start = 0;
+
+    while (start < total)
+    {
+        size_t end = min(total, start + window_);
+
+        if (end < total && memchr(data + start, '\n', end - start) == nullptr)
+        {
+            //Line is longer than the window. Stretch the window to the line end
+            const char *found = static_cast<const char *>(memchr(data + end, '\n', total - end));
+            end = (found != nullptr) ? (found - data) + 1 : total;
+        }
+
+        const char *block = data + start;
+        const size_t block_size = end - start;
+
+        if (positions_.size() < block_size)
+        {
+            positions_.resize(block_size);
+        }
+
+        const size_t count = ScanDelimiters(block, block_size, positions_.data());
+
+        size_t line_start = 0;
+        size_t token_start = 0;
+        tokens_.clear();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t position = positions_[i];
+
+            if (position != token_start)
+            {
+                tokens_.push_back(string_view(block + token_start, position - token_start));
+            }
+
+            token_start = position + 1;
+
+            if (block[position] == '\n')
+            {
+                if (position != line_start)
+                {
+                    handler(string_view(block + line_start, position - line_start), tokens_);
+                }
+
+                tokens_.clear();
+                line_start = token_start;
+            }
+        }
+
+        if (end == total)
+        {
+            //Last line of the buffer is not terminated
+            if (line_start != block_size)
+            {
+                if (token_start != block_size)
+                {
+                    tokens_.push_back(string_view(block + token_start, block_size - token_start));
+                }
+
+                handler(string_view(block + line_start, block_size - line_start), tokens_);
+            }
+
+            return;
+        }
+
+        //Incomplete line at the end of the window is scanned again with the next one
+        start += line_start;
+    }
+}
+
+} // namespace tokenizers
+} // namespace md
+
+#endif /* delimiter_scanner_hpp */
@@ -0,0 +1,101 @@
+//
+//  depth_index.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 18.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "depth_index.hpp"
+
+//System includes
+#include <algorithm>
+
+//Local includes
+
+/**************************** Implementation **************************/
+
+void DepthIndex::reset(size_t size)
+{
+    quantity_.assign(size + 1, 0);
+    notional_.assign(size + 1, 0);
+    total_quantity_ = 0;
+    total_notional_ = 0;
+
+    top_step_ = 1;
+
+    while (top_step_ * 2 <= size)
+    {
+        top_step_ *= 2;
+    }
+}
+
+void DepthIndex::update(size_t position, uint64_t old_quantity, uint64_t new_quantity, Price price)
+{
+    //Deltas wrap around, so a smaller quantity is the same as the subtraction
+    const uint64_t quantity_delta = new_quantity - old_quantity;
+    const uint64_t notional_delta = quantity_delta * static_cast<uint64_t>(price);
+
+    total_quantity_ += quantity_delta;
+    total_notional_ += notional_delta;
+
+    for (size_t index = position + 1; index < quantity_.size(); index += index & (~index + 1))
+    {
+        quantity_[index] += quantity_delta;
+        notional_[index] += notional_delta;
+    }
+}
+
+uint64_t DepthIndex::totalQuantity() const
+{
+    return total_quantity_;
+}
+
+uint64_t DepthIndex::totalNotional() const
+{
+    return total_notional_;
+}
+
+size_t DepthIndex::search(uint64_t quantity, uint64_t &covered_quantity, uint64_t &covered_notional) const
+{
+    size_t position = 0;
+
+    covered_quantity = 0;
+    covered_notional = 0;
+
+    //Largest prefix which holds less than the requested quantity
+    for (size_t step = top_step_; step != 0; step /= 2)
+    {
+        const size_t next = position + step;
+
+        if (next < quantity_.size() && covered_quantity + quantity_[next] < quantity)
+        {
+            position = next;
+            covered_quantity += quantity_[next];
+            covered_notional += notional_[next];
+        }
+    }
+
+    return position;
+}
+
+uint64_t DepthNotional(const vector<DepthStep> &steps, uint64_t quantity)
+{
+    auto found = lower_bound(steps.begin(), steps.end(), quantity,
+                             [](const DepthStep &step, uint64_t value) { return step.quantity < value; });
+
+    if (found == steps.end())
+    {
+        return steps.empty() ? 0 : steps.back().notional;
+    }
+
+    uint64_t covered_quantity = 0, covered_notional = 0;
+
+    if (found != steps.begin())
+    {
+        covered_quantity = prev(found)->quantity;
+        covered_notional = prev(found)->notional;
+    }
+
+    return covered_notional + static_cast<uint64_t>(found->price) * (quantity - covered_quantity);
+}
@@ -0,0 +1,118 @@
+//
+//  depth_index.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 18.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef depth_index_hpp
+#define depth_index_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+#include "price.hpp"
+
+using namespace std;
+
+/**
+ * Fenwick tree of the quantity and of the price times quantity over the
+ * fixed number of positions. Positions are the price levels in the order
+ * they are walked from the best one, so the best shares of the side are
+ * found by the prefix search in O(log size). Sums wrap around at 2^64 and
+ * are exact while the real ones fit. Is not thread safe
+ */
+class DepthIndex final
+{
+public:
+    /** Default constructor. Has no positions until reset */
+    DepthIndex() = default;
+
+    /** Default destructor */
+    ~DepthIndex() = default;
+
+    /**
+     * Is used to drop all the sums
+     * @param size number of the positions
+     */
+    void reset(size_t size);
+
+    /**
+     * Is used to change the quantity of the position
+     * @param position index of the position
+     * @param old_quantity quantity which was added for the position before
+     * @param new_quantity current quantity of the position
+     * @param price of the position in ticks. Must not be negative
+     */
+    void update(size_t position, uint64_t old_quantity, uint64_t new_quantity, Price price);
+
+    /**
+     * Is used to get the quantity of all the positions
+     * @return number of shares
+     */
+    uint64_t totalQuantity() const;
+
+    /**
+     * Is used to get the price times quantity of all the positions
+     * @return sum in ticks
+     */
+    uint64_t totalNotional() const;
+
+    /**
+     * Is used to find the position which holds the requested share
+     * @param quantity number of the shares to cover. Must not be above totalQuantity
+     * @param covered_quantity where to store the quantity of the positions before the found one
+     * @param covered_notional where to store the price times quantity of the positions before the found one
+     * @return index of the position
+     */
+    size_t search(uint64_t quantity, uint64_t &covered_quantity, uint64_t &covered_notional) const;
+
+private:
+    /** Sums of the quantity. Index zero is not used */
+    vector<uint64_t> quantity_;
+
+    /** Sums of the price times quantity. Index zero is not used */
+    vector<uint64_t> notional_;
+
+    /** Highest power of two which is not above the size */
+    size_t top_step_ = 0;
+
+    /** Quantity of all the positions */
+    uint64_t total_quantity_ = 0;
+
+    /** Price times quantity of all the positions */
+    uint64_t total_notional_ = 0;
+
+    PREVENT_COPY(DepthIndex);
+};
+
+/**
+ * Running sums up to and including one price level. Is used for the levels
+ * which change seldom, so the sums are rebuilt rather than updated
+ */
+struct DepthStep
+{
+    /** Price of the level in ticks */
+    Price price;
+
+    /** Quantity of the levels up to this one */
+    uint64_t quantity;
+
+    /** Price times quantity of the levels up to this one */
+    uint64_t notional;
+};
+
+/**
+ * Is used to get the price times quantity of the best shares of the levels
+ * @param steps running sums of the levels from the best one
+ * @param quantity number of the shares to cover
+ * @return sum in ticks. All the levels if they hold less than quantity
+ */
+uint64_t DepthNotional(const vector<DepthStep> &steps, uint64_t quantity);
+
+#endif /* depth_index_hpp */
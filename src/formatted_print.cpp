@@ -9,7 +9,6 @@
 #include "formatted_print.hpp"
 
 //System includes
-#include <map>
 #include <iostream>
 #include <iomanip>
 
@@ -36,22 +35,27 @@ const int default_precision = 2;
 
 /**************************** Implementation **************************/
 
-void PrintBboInfo(const string &symbol)
+void PrintBboInfo(OrderRegistry &registry, SymbolId symbol_id)
 {
-    auto &bbo_subscribers = OrderRegistry::get().getBboSubscribers();
+    auto &subscriber_count = registry.getBboSubscribers()[symbol_id];
 
-    if (bbo_subscribers[symbol] > 0)
+    //From now on the symbol is known to unsubscribe
+    if (!subscriber_count)
     {
-        //We have subscribers for this symbol
+        subscriber_count = 0;
+    }
 
-        const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
+    if (*subscriber_count > 0)
+    {
+        //We have subscribers for this symbol
 
-        auto search = symbol_to_orders.find(symbol);
+        const string &symbol = registry.getSymbols().name(symbol_id);
+        SymbolOrderList *order_list = registry.findOrderList(symbol_id);
 
-        if (search != symbol_to_orders.end())
+        if (order_list != nullptr)
         {
             //This symbol is registered
-            auto bbo = search->second->bbo();
+            const OrderBbo &bbo = order_list->bbo();
 
             cout << '|' << setw(default_width) << "#orders"
                 << '|' << setw(default_width) << "quantity"
@@ -62,6 +66,7 @@ void PrintBboInfo(const string &symbol)
                 << '|' << " <-- " << symbol << " BBO" << '\n';
 
             cout << bbo << '\n';
+            order_list->resetBboChanged();
         }
         else
         {
@@ -77,25 +82,22 @@ void PrintBboInfo(const string &symbol)
     }
 }
 
-void PrintVwapInfo(const string &symbol)
+void PrintVwapInfo(OrderRegistry &registry, SymbolId symbol_id)
 {
     try
     {
-        auto &vwap_subscribers = OrderRegistry::get().getVwapSubscribers();
-
-        const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
-
-        auto search = symbol_to_orders.find(symbol);
+        const string &symbol = registry.getSymbols().name(symbol_id);
+        SymbolOrderList *order_list = registry.findOrderList(symbol_id);
 
-        if (search != symbol_to_orders.end())
+        if (order_list != nullptr)
         {
-            for (const auto &vwap_info : vwap_subscribers[symbol])
+            for (const auto &vwap_info : registry.getVwapSubscribers()[symbol_id])
             {
                 if (vwap_info.second > 0)
                 {
                     //We have subscribers for this quantity
 
-                    auto vwap = search->second->vwap(vwap_info.first);
+                    auto vwap = order_list->vwap(vwap_info.first);
 
                     cout << "<buy price, sell price> <-- " << symbol <<
                         " VWAP(" << vwap_info.first << ")" << '\n';
@@ -124,33 +126,10 @@ void PrintVwapInfo(const string &symbol)
     }
 }
 
-void PrintPriceLevels(OrderIterator itr, const string &symbol_to_print)
+void PrintPriceLevels(const BidBook &bids, const AskBook &asks, const string &symbol_to_print)
 {
-    //format for map: price is a key, value is a volume
-    map<double, uint64_t, greater<double>> bid_price_levels;
-    map<double, uint64_t, less<double>> ask_price_levels;
-
-    for (;
-        itr.done() != OrderIterator::ALL_DONE;
-        itr.next())
-    {
-        auto done_status = itr.done();
-
-        if(done_status != OrderIterator::BID_DONE)
-        {
-            const auto &bid_order = itr.getBid();
-            bid_price_levels[bid_order.price] += bid_order.quantity;
-        }
-
-        if(done_status != OrderIterator::ASK_DONE)
-        {
-            const auto &ask_order = itr.getAsk();
-            ask_price_levels[ask_order.price] += ask_order.quantity;
-        }
-    }
-
-    auto bid_itr = bid_price_levels.cbegin();
-    auto ask_itr = ask_price_levels.cbegin();
+    auto bid_itr = bids.begin();
+    auto ask_itr = asks.begin();
 
     //Output format is:
     //Bid                             Ask
@@ -160,10 +139,10 @@ void PrintPriceLevels(OrderIterator itr, const string &symbol_to_print)
 
     do
     {
-        if(bid_itr != bid_price_levels.cend())
+        if(bid_itr != bids.end())
         {
-            cout << '<' << bid_itr->second
-                    << '@' << fixed << setprecision(default_precision) << bid_itr->first
+            cout << '<' << bid_itr->total_quantity
+                    << '@' << fixed << setprecision(default_precision) << PriceToDouble(bid_itr->price)
                     << '>';
             bid_itr++;
         }
@@ -176,10 +155,10 @@ void PrintPriceLevels(OrderIterator itr, const string &symbol_to_print)
 
         cout << '|';
 
-        if(ask_itr != ask_price_levels.cend())
+        if(ask_itr != asks.end())
         {
-            cout << '<' << ask_itr->second
-                    << '@' << fixed << setprecision(default_precision) << ask_itr->first
+            cout << '<' << ask_itr->total_quantity
+                    << '@' << fixed << setprecision(default_precision) << PriceToDouble(ask_itr->price)
                     << '>' << '\n';
             ask_itr++;
         }
@@ -190,7 +169,7 @@ void PrintPriceLevels(OrderIterator itr, const string &symbol_to_print)
                     << '>' << '\n';
         }
     }
-    while (bid_itr != bid_price_levels.cend() || ask_itr != ask_price_levels.cend());
+    while (bid_itr != bids.end() || ask_itr != asks.end());
 }
 
 void PrintFullOrderList(OrderIterator itr, const string &symbol_to_print)
@@ -227,7 +206,7 @@ void PrintFullOrderList(OrderIterator itr, const string &symbol_to_print)
 
             cout << '|' << setw(default_width) << bid_order.order_id
                     << '|' << setw(default_width) << bid_order.quantity
-                    << '|' << setw(default_width) << fixed << setprecision(default_precision) << bid_order.price;
+                    << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(bid_order.price);
         }
         else
         {
@@ -240,7 +219,7 @@ void PrintFullOrderList(OrderIterator itr, const string &symbol_to_print)
         {
             const auto &ask_order = itr.getAsk();
 
-            cout << '|' << setw(default_width) << fixed << setprecision(default_precision) << ask_order.price
+            cout << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(ask_order.price)
                     << '|' << setw(default_width) << ask_order.quantity
                     << '|' << setw(default_width) << ask_order.order_id
                     << '|' << '\n';
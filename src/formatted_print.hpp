@@ -14,27 +14,35 @@
 
 //Local includes
 #include "order_iterator.hpp"
+#include "price_ladder_book.hpp"
+#include "symbol_table.hpp"
 
 using namespace std;
 
+//Forward declarations
+class OrderRegistry;
+
 /**
 * This function performs the actual bbo print upon the add, modify or cancel commands
-* @param symbol to search for subscriptions
+* @param registry order data of the replay
+* @param symbol_id id of the symbol to search for subscriptions
 */
-void PrintBboInfo(const string &symbol);
+void PrintBboInfo(OrderRegistry &registry, SymbolId symbol_id);
 
 /**
 * This function performs the actual vwap print upon the add, modify or cancel commands
-* @param symbol to search for subscriptions
+* @param registry order data of the replay
+* @param symbol_id id of the symbol to search for subscriptions
 */
-void PrintVwapInfo(const string &symbol);
+void PrintVwapInfo(OrderRegistry &registry, SymbolId symbol_id);
 
 /**
 * This function prints down the price levels of the order book
-* @param itr iterator to the order list
+* @param bids "Buy" side of the book
+* @param asks "Sell" side of the book
 * @param symbol_to_print symbol to print in the header
 */
-void PrintPriceLevels(OrderIterator itr, const string &symbol_to_print);
+void PrintPriceLevels(const BidBook &bids, const AskBook &asks, const string &symbol_to_print);
 
 /**
 * This function prints down the full order list
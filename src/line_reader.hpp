@@ -0,0 +1,55 @@
+//
+//  line_reader.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 03.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef line_reader_hpp
+#define line_reader_hpp
+
+//System includes
+#include <string_view>
+#include <cstring>
+
+//Local includes
+
+namespace md
+{
+namespace readers
+{
+
+using namespace std;
+
+/**
+ * Iterates through the lines of the buffer without copying them. Follows the
+ * getline semantics: lines are separated by '\n' and the last line is handled
+ * even if it is not terminated. Empty lines are skipped
+ * @param buffer what to split in to the lines
+ * @param handler callable with string_view argument. Is called for every line
+ */
+template<typename Handler>
+void ForEachLine(string_view buffer, Handler handler)
+{
+    const char *current = buffer.data();
+    const char *end = current + buffer.size();
+
+    while (current < end)
+    {
+        const char *found = static_cast<const char *>(memchr(current, '\n', end - current));
+        const char *line_end = (found != nullptr) ? found : end;
+
+        if (line_end != current)
+        {
+            handler(string_view(current, line_end - current));
+        }
+
+        current = line_end + 1;
+    }
+}
+
+} // namespace readers
+} // namespace md
+
+#endif /* line_reader_hpp */
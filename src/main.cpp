@@ -9,59 +9,243 @@
 //System includes
 #include <stdlib.h>
 #include <iostream>
-#include <fstream>
+#include <vector>
 
 //Local includes
-#include "split.hpp"
 #include "md_processor.hpp"
+#include "mapped_file.hpp"
+#include "delimiter_scanner.hpp"
+#include "binary_codec.hpp"
+#include "parallel_replay.hpp"
+#include "numeric_parser.hpp"
+#include "read_ahead.hpp"
+#include "line_reader.hpp"
 
 using namespace std;
 
-/** Program entry point */
-int main(int argc, const char * argv[])
+/******************************* Helpers ******************************/
+
+namespace
+{
+
+/** Number of the decoded commands handed over to the processor at once */
+const size_t BATCH_SIZE = 4096;
+
+/**
+ * Reports the line which the processor failed to handle
+ * @param line what was processed
+ */
+void ReportFailure(string_view line)
 {
-    if (argc < 2)
+    cout << "Failure line: [" << line << "]" << '\n';
+}
+
+/**
+ * Is used to parse the modify priority option
+ * @param value text of the option
+ * @param priority where to store the result
+ * @return true if the value is known
+ */
+bool ParseModifyPriority(string_view value, ModifyPriority &priority)
+{
+    if (value == "requeue")
     {
-        cerr << "Usage: md_replay <file> [<symbol>]" << '\n';
-        exit(EXIT_FAILURE);
+        priority = MODIFY_REQUEUE;
+    }
+    else if (value == "size-down")
+    {
+        priority = MODIFY_KEEP_ON_SIZE_DOWN;
+    }
+    else if (value == "same-price")
+    {
+        priority = MODIFY_KEEP_ON_SAME_PRICE;
+    }
+    else
+    {
+        return false;
     }
 
-    string filename, symbol;
+    return true;
+}
+
+/** Prints the usage and exits */
+[[noreturn]] void Usage()
+{
+    cerr << "Usage: md_replay [-j <threads>] [-s] [-p <priority>] <file> [<symbol>]" << '\n';
+    cerr << "  <file>        feed to replay, - for the standard input. gzip and zstd are detected" << '\n';
+    cerr << "  -j <threads>  parse text feeds on the given number of threads, 0 - one per core" << '\n';
+    cerr << "  -s            strict filter: drop the orders of the other symbols before parsing" << '\n';
+    cerr << "  -p <priority> queue place of the same price modify: requeue (default)," << '\n';
+    cerr << "                size-down - kept on quantity decrease, same-price - always kept" << '\n';
+    exit(EXIT_FAILURE);
+}
 
-    if (argc > 2)
+} // namespace
+
+/**************************** Entry point *****************************/
+
+/** Program entry point */
+int main(int argc, const char * argv[])
+{
+    uint64_t threads = 1;
+    bool strict = false;
+    ModifyPriority priority = MODIFY_REQUEUE;
+    vector<string> arguments;
+
+    for (int i = 1; i < argc; ++i)
     {
-        symbol = argv[2];
+        const string_view arg = argv[i];
+
+        if (arg == "-j")
+        {
+            if (i + 1 == argc || md::tokenizers::ParseUnsigned(argv[++i], threads) != md::tokenizers::PARSE_OK)
+            {
+                Usage();
+            }
+        }
+        else if (arg == "-s")
+        {
+            strict = true;
+        }
+        else if (arg == "-p")
+        {
+            if (i + 1 == argc || !ParseModifyPriority(argv[++i], priority))
+            {
+                Usage();
+            }
+        }
+        else
+        {
+            arguments.emplace_back(arg);
+        }
     }
 
-    filename = argv[1];
+    if (arguments.empty() || arguments.size() > 2)
+    {
+        Usage();
+    }
 
-    ifstream infs(filename);
+    string filename, symbol;
 
-    if (!infs.is_open())
+    if (arguments.size() > 1)
     {
-        cerr << "failed to open " << filename << '\n';
-        exit(EXIT_FAILURE);
+        symbol = arguments[1];
     }
 
-    vector<string> tokens;
+    filename = arguments[0];
+
     md::processors::MdProcessor processor;
     processor.setFilter(symbol);
+    processor.setStrictFilter(strict);
+    processor.getRegistry().setModifyPriority(priority);
+
+    md::readers::MappedFile mapped;
+
+    if (filename != "-" && mapped.open(filename)
+        && md::readers::DetectCompression(mapped.view()) != md::readers::COMPRESSION_NONE)
+    {
+        //Compressed file. Is decoded by the reading thread below
+        mapped.close();
+    }
 
-    //Iterate through the lines of file and feed each to the processor
-    for (string line; getline( infs, line ); )
+    if (mapped.isOpen() && md::binary::IsBinaryFeed(mapped.view()))
     {
-        if (line.empty())
+        //Feed converted by md_convert. Records go straight to the processor
+        md::binary::BinaryFeed feed;
+
+        if (!feed.open(mapped.view()))
         {
-            //Do not process empty lines
-            continue;
+            cerr << "failed to read binary feed " << filename << '\n';
+            exit(EXIT_FAILURE);
+        }
+
+        for (size_t i = 0; i < feed.size(); ++i)
+        {
+            const md::binary::BinaryRecord record = feed.record(i);
+
+            if (!md::binary::ReplayRecord(record, feed, processor))
+            {
+                ReportFailure(md::binary::RecordToLine(record, feed));
+            }
         }
 
-        tokens = split(line, ',');
+        exit(EXIT_SUCCESS);
+    }
+
+    if (mapped.isOpen() && threads != 1)
+    {
+        //Regular file. Lines are parsed on the worker threads and applied here
+        md::processors::ParallelReplay replay(processor, threads);
+        replay.run(mapped.view(), ReportFailure);
+
+        exit(EXIT_SUCCESS);
+    }
+
+    if (mapped.isOpen() && processor.isStrictFilter())
+    {
+        //Regular file. Most of the lines are dropped, so do not tokenize them in bulk
+        md::readers::ForEachLine(mapped.view(), [&processor](string_view line)
+        {
+            if (!processor.processFiltered(line))
+            {
+                ReportFailure(line);
+            }
+        });
+
+        exit(EXIT_SUCCESS);
+    }
+
+    if (mapped.isOpen())
+    {
+        //Regular file. Lines are tokenized straight from the mapping and applied in batches
+        md::tokenizers::BlockTokenizer tokenizer;
+        md::tokenizers::MdDecoder decoder;
+        vector<md::tokenizers::MdCommand> batch;
+        batch.reserve(BATCH_SIZE);
+
+        auto on_failure = [](const md::tokenizers::MdCommand &command)
+        {
+            ReportFailure(command.line);
+        };
+
+        tokenizer.forEachLine(mapped.view(), [&](string_view line, const md::tokenizers::TokenList &tokens)
+        {
+            batch.emplace_back();
+            decoder.decode(line, tokens, batch.back());
+
+            if (batch.size() == BATCH_SIZE)
+            {
+                processor.processBatch(batch.data(), batch.size(), on_failure);
+                batch.clear();
+            }
+        });
+
+        processor.processBatch(batch.data(), batch.size(), on_failure);
+
+        exit(EXIT_SUCCESS);
+    }
+
+    //Can't be mapped (pipe, stdin, compressed, etc.). Read ahead on the separate thread
+    md::readers::ReadAheadReader reader;
+
+    if (!reader.open(filename))
+    {
+        cerr << "failed to open " << filename << '\n';
+        exit(EXIT_FAILURE);
+    }
 
-        if (!processor.process(tokens))
+    reader.forEachLine([&processor](string_view line, const md::tokenizers::TokenList &tokens)
+    {
+        if (!processor.processFiltered(line, tokens))
         {
-            cout << "Failure line: [" << line << "]" << '\n';
+            ReportFailure(line);
         }
+    });
+
+    if (reader.failed())
+    {
+        cerr << "failed to read " << filename << '\n';
+        exit(EXIT_FAILURE);
     }
 
     exit(EXIT_SUCCESS);
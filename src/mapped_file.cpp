@@ -0,0 +1,104 @@
+//
+//  mapped_file.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 03.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "mapped_file.hpp"
+
+//System includes
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//Local includes
+
+using namespace std;
+using namespace md::readers;
+
+
+MappedFile::MappedFile() :
+    data_(nullptr),
+    size_(0),
+    open_(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const string &filename)
+{
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+    {
+        //Pipes and devices can't be mapped. Caller should stream them
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+
+    if (size == 0)
+    {
+        //mmap refuses zero length mappings. Nothing to read anyway
+        ::close(fd);
+        open_ = true;
+        return true;
+    }
+
+    void *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    //The mapping holds its own reference to the file
+    ::close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+
+    madvise(address, size, MADV_SEQUENTIAL);
+
+    data_ = static_cast<const char *>(address);
+    size_ = size;
+    open_ = true;
+
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<char *>(data_), size_);
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+
+bool MappedFile::isOpen() const
+{
+    return open_;
+}
+
+string_view MappedFile::view() const
+{
+    return string_view(data_, size_);
+}
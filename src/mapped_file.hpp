@@ -0,0 +1,82 @@
+//
+//  mapped_file.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 03.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef mapped_file_hpp
+#define mapped_file_hpp
+
+//System includes
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+//Local includes
+#include "defines.h"
+
+namespace md
+{
+namespace readers
+{
+
+using namespace std;
+
+/**
+ * Read only memory mapping of the regular file. Is used to feed the whole
+ * input to the processor without copying it line by line. Files which can't
+ * be mapped (pipes, character devices, etc.) are refused, so the caller can
+ * fall back to the stream reading.
+ */
+class MappedFile
+{
+public:
+    /** Default constructor */
+    MappedFile();
+
+    /** Destructor. Unmaps the file if it is still mapped */
+    ~MappedFile();
+
+    /**
+     * Is used to map the file in to the memory. Kernel is advised about the
+     * sequential access pattern so the read ahead is more aggressive
+     * @param filename path to the file to be mapped
+     * @return true if the file was mapped, false otherwise
+     */
+    bool open(const string &filename);
+
+    /** Unmaps the file. Safe to be called on the closed object */
+    void close();
+
+    /**
+     * Is used to check whether or not the file is mapped
+     * @return true if mapped
+     */
+    bool isOpen() const;
+
+    /**
+     * Is used to get the whole content of the mapped file
+     * @return view on the mapped memory. Empty if nothing is mapped
+     */
+    string_view view() const;
+
+private:
+    /** Start of the mapped region. Null for the empty or closed file */
+    const char *data_;
+
+    /** Size of the mapped region in bytes */
+    size_t size_;
+
+    /** Is set once the file was successfully opened */
+    bool open_;
+
+    PREVENT_COPY(MappedFile);
+    PREVENT_MOVE(MappedFile);
+};
+
+} // namespace readers
+} // namespace md
+
+#endif /* mapped_file_hpp */
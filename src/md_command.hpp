@@ -0,0 +1,136 @@
+//
+//  md_command.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef md_command_hpp
+#define md_command_hpp
+
+//System includes
+#include <cstdint>
+#include <string_view>
+
+//Local includes
+#include "price.hpp"
+#include "container_definitions.hpp"
+
+namespace md
+{
+namespace tokenizers
+{
+
+using namespace std;
+
+/** Type of the decoded command */
+enum MdCommandType
+{
+    COMMAND_INVALID,
+    COMMAND_ORDER_ADD,
+    COMMAND_ORDER_MODIFY,
+    COMMAND_ORDER_CANCEL,
+    COMMAND_SUBSCRIBE_BBO,
+    COMMAND_UNSUBSCRIBE_BBO,
+    COMMAND_SUBSCRIBE_VWAP,
+    COMMAND_UNSUBSCRIBE_VWAP,
+    COMMAND_PRINT,
+    COMMAND_PRINT_FULL
+};
+
+/**
+ * Decoded and validated command. Is produced from the text line without
+ * touching the order books, so it can be done on any thread. Fields which
+ * the command does not have are left zero.
+ */
+struct MdCommand
+{
+    /** What to do. COMMAND_INVALID if the line failed the validation */
+    MdCommandType type;
+
+    /** Side of the Order Add */
+    OrderSide side;
+
+    /** Order id for the order commands */
+    uint64_t order_id;
+
+    /** Order quantity or the vwap quantity */
+    uint64_t quantity;
+
+    /** Order price in the fixed point ticks */
+    Price price;
+
+    /** Symbol of the command. Points in to the line */
+    string_view symbol;
+
+    /** Original line */
+    string_view line;
+};
+
+/**
+ * Is used to get the command type by its text name. Names are told apart by
+ * the length and at most one character, then confirmed with one compare, so
+ * there is no hashing and no lookup table
+ * @param name first token of the line
+ * @return command type. COMMAND_INVALID if the name is unknown
+ */
+inline MdCommandType CommandTypeOf(string_view name)
+{
+    MdCommandType type = COMMAND_INVALID;
+    string_view expected;
+
+    switch (name.size())
+    {
+        case 5:
+            type = COMMAND_PRINT;
+            expected = "PRINT";
+            break;
+        case 9:
+            type = COMMAND_ORDER_ADD;
+            expected = "ORDER ADD";
+            break;
+        case 10:
+            type = COMMAND_PRINT_FULL;
+            expected = "PRINT_FULL";
+            break;
+        case 12:
+            //"ORDER MODIFY" and "ORDER CANCEL"
+            if (name[6] == 'M')
+            {
+                type = COMMAND_ORDER_MODIFY;
+                expected = "ORDER MODIFY";
+            }
+            else
+            {
+                type = COMMAND_ORDER_CANCEL;
+                expected = "ORDER CANCEL";
+            }
+            break;
+        case 13:
+            type = COMMAND_SUBSCRIBE_BBO;
+            expected = "SUBSCRIBE BBO";
+            break;
+        case 14:
+            type = COMMAND_SUBSCRIBE_VWAP;
+            expected = "SUBSCRIBE VWAP";
+            break;
+        case 15:
+            type = COMMAND_UNSUBSCRIBE_BBO;
+            expected = "UNSUBSCRIBE BBO";
+            break;
+        case 16:
+            type = COMMAND_UNSUBSCRIBE_VWAP;
+            expected = "UNSUBSCRIBE VWAP";
+            break;
+        default:
+            return COMMAND_INVALID;
+    }
+
+    return (name == expected) ? type : COMMAND_INVALID;
+}
+
+} // namespace tokenizers
+} // namespace md
+
+#endif /* md_command_hpp */
@@ -9,6 +9,7 @@
 #include "md_command_data.hpp"
 
 //System includes
+#include <iostream>
 
 //Local includes
 
@@ -18,14 +19,16 @@ using namespace md::tokenizers;
 
 MdCommandData::MdCommandData() :
     process_state_(false),
-    error_message_("Object is empty")
+    error_message_("Object is empty"),
+    quiet_(false)
 {
 }
 
 
 MdCommandData::MdCommandData(MdCommandData & obj) :
     process_state_(obj.process_state_),
-    error_message_(obj.error_message_)
+    error_message_(obj.error_message_),
+    quiet_(obj.quiet_)
 {
 }
 
@@ -33,6 +36,7 @@ MdCommandData & MdCommandData::operator=(const MdCommandData &obj)
 {
     process_state_ = obj.process_state_;
     error_message_ = obj.error_message_;
+    quiet_ = obj.quiet_;
     return *this;
 }
 
@@ -41,17 +45,34 @@ bool MdCommandData::isProcessed()
     return process_state_;
 }
 
-const string & MdCommandData::errorMessage()
+string_view MdCommandData::errorMessage()
 {
     return error_message_;
 }
 
+void MdCommandData::setQuiet(bool quiet)
+{
+    quiet_ = quiet;
+}
+
 void MdCommandData::setProcessed(bool state)
 {
     process_state_ = state;
 }
 
-void MdCommandData::setErrorMessage(const string &message)
+void MdCommandData::setErrorMessage(string_view message)
 {
     error_message_ = message;
-}
\ No newline at end of file
+}
+
+void MdCommandData::setNumericFailure(const char *caller, ParseStatus status)
+{
+    if (!quiet_)
+    {
+        cerr << caller << ": Numeric conversion failure: ["
+            << ParseStatusMessage(status) << "]" << '\n';
+    }
+
+    setProcessed(false);
+    setErrorMessage("Critical failure");
+}
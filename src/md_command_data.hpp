@@ -10,10 +10,11 @@
 #define md_command_data_hpp
 
 //System includes
-#include <string>
-#include <vector>
+#include <string_view>
 
 //Local includes
+#include "tokenizer.hpp"
+#include "numeric_parser.hpp"
 
 namespace md
 {
@@ -50,9 +51,9 @@ public:
     /**
      * Defines the operation to process all of the tokens. Must be implemented in
      * the child classes.
-     * @param tokens vector of the string command tokens
+     * @param tokens list of the command tokens
      */
-    virtual void processTokens(const vector<string> &tokens) = 0;
+    virtual void processTokens(const TokenList &tokens) = 0;
 
     /**
      * Is used to check whether or not the processTokens operation went successful
@@ -65,7 +66,14 @@ public:
      * Is used to get the failure error message from the object.
      * @return Error message
      */
-    virtual const string & errorMessage() final;
+    virtual string_view errorMessage() final;
+
+    /**
+     * Is used to suppress the diagnostics which are printed while processing.
+     * Is needed when the tokens are processed off the output thread
+     * @param quiet true to suppress, false to print (default)
+     */
+    virtual void setQuiet(bool quiet) final;
 
 protected:
 
@@ -77,17 +85,27 @@ protected:
 
     /**
      * Is used to set the error message
-     * @param message of the processing failure
+     * @param message of the processing failure. Must be a string literal
      */
-    virtual void setErrorMessage(const string &message) final;
+    virtual void setErrorMessage(string_view message) final;
+
+    /**
+     * Is used to mark the processing as failed because of the bad numeric field
+     * @param caller name of the function to be shown in the diagnostics
+     * @param status what was wrong with the number
+     */
+    virtual void setNumericFailure(const char *caller, ParseStatus status) final;
 
 private:
 
     /** State of the processing of tokens. True is ok&done, false if failed */
     bool process_state_;
 
-    /** Will hold the error string of  */
-    string error_message_;
+    /** Will hold the error string of the last processing. Always a literal */
+    string_view error_message_;
+
+    /** If set no diagnostics are printed */
+    bool quiet_;
 };
 
 } // namespace tokenizers
@@ -0,0 +1,158 @@
+//
+//  md_decoder.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "md_decoder.hpp"
+
+//System includes
+
+//Local includes
+
+using namespace std;
+using namespace md::tokenizers;
+
+/**************************** Implementation **************************/
+
+MdDecoder::MdDecoder(bool quiet) :
+    subscribe_bbo_("SUBSCRIBE BBO"),
+    unsubscribe_bbo_("UNSUBSCRIBE BBO"),
+    subscribe_vwap_("SUBSCRIBE VWAP"),
+    unsubscribe_vwap_("UNSUBSCRIBE VWAP"),
+    print_("PRINT"),
+    print_full_("PRINT_FULL"),
+    failed_type_(COMMAND_INVALID),
+    failed_(nullptr)
+{
+    for (MdCommandData *obj : initializer_list<MdCommandData *>{&order_add_, &order_modify_, &order_cancel_,
+                                                                &subscribe_bbo_, &unsubscribe_bbo_,
+                                                                &subscribe_vwap_, &unsubscribe_vwap_,
+                                                                &print_, &print_full_})
+    {
+        obj->setQuiet(quiet);
+    }
+}
+
+bool MdDecoder::decode(string_view line, const TokenList &tokens, MdCommand &command)
+{
+    command = MdCommand();
+    command.line = line;
+
+    failed_type_ = COMMAND_INVALID;
+    failed_ = nullptr;
+
+    if (tokens.empty())
+    {
+        return false;
+    }
+
+    const MdCommandType type = CommandTypeOf(tokens[MdCommandData::COMMAND_NAME]);
+
+    switch (type)
+    {
+        case COMMAND_ORDER_ADD:
+            order_add_.processTokens(tokens);
+
+            if (!order_add_.isProcessed())
+            {
+                return fail(type, order_add_);
+            }
+
+            command.order_id = order_add_.getOrderId();
+            command.symbol = order_add_.getSymbol();
+            command.side = order_add_.getSide();
+            command.quantity = order_add_.getQuantity();
+            command.price = order_add_.getPriceTicks();
+            break;
+        case COMMAND_ORDER_MODIFY:
+            order_modify_.processTokens(tokens);
+
+            if (!order_modify_.isProcessed())
+            {
+                return fail(type, order_modify_);
+            }
+
+            command.order_id = order_modify_.getOrderId();
+            command.quantity = order_modify_.getQuantity();
+            command.price = order_modify_.getPriceTicks();
+            break;
+        case COMMAND_ORDER_CANCEL:
+            order_cancel_.processTokens(tokens);
+
+            if (!order_cancel_.isProcessed())
+            {
+                return fail(type, order_cancel_);
+            }
+
+            command.order_id = order_cancel_.getOrderId();
+            break;
+        case COMMAND_SUBSCRIBE_BBO:
+        case COMMAND_UNSUBSCRIBE_BBO:
+        {
+            auto &obj = (type == COMMAND_SUBSCRIBE_BBO) ? subscribe_bbo_ : unsubscribe_bbo_;
+            obj.processTokens(tokens);
+
+            if (!obj.isProcessed())
+            {
+                return fail(type, obj);
+            }
+
+            command.symbol = obj.getSymbol();
+            break;
+        }
+        case COMMAND_SUBSCRIBE_VWAP:
+        case COMMAND_UNSUBSCRIBE_VWAP:
+        {
+            auto &obj = (type == COMMAND_SUBSCRIBE_VWAP) ? subscribe_vwap_ : unsubscribe_vwap_;
+            obj.processTokens(tokens);
+
+            if (!obj.isProcessed())
+            {
+                return fail(type, obj);
+            }
+
+            command.symbol = obj.getSymbol();
+            command.quantity = obj.getQuantity();
+            break;
+        }
+        case COMMAND_PRINT:
+        case COMMAND_PRINT_FULL:
+        {
+            auto &obj = (type == COMMAND_PRINT) ? print_ : print_full_;
+            obj.processTokens(tokens);
+
+            if (!obj.isProcessed())
+            {
+                return fail(type, obj);
+            }
+
+            command.symbol = obj.getSymbol();
+            break;
+        }
+        default:
+            return false;
+    }
+
+    command.type = type;
+    return true;
+}
+
+MdCommandType MdDecoder::failedType() const
+{
+    return failed_type_;
+}
+
+string_view MdDecoder::errorMessage() const
+{
+    return (failed_ != nullptr) ? failed_->errorMessage() : string_view();
+}
+
+bool MdDecoder::fail(MdCommandType type, MdCommandData &obj)
+{
+    failed_type_ = type;
+    failed_ = &obj;
+    return false;
+}
@@ -0,0 +1,106 @@
+//
+//  md_decoder.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef md_decoder_hpp
+#define md_decoder_hpp
+
+//System includes
+#include <string_view>
+
+//Local includes
+#include "defines.h"
+#include "md_command.hpp"
+#include "tokenizer.hpp"
+#include "order_add_data.hpp"
+#include "order_modify_data.hpp"
+#include "order_cancel_data.hpp"
+#include "bbo_subscription_data.hpp"
+#include "vwap_subscription_data.hpp"
+#include "print_data.hpp"
+
+namespace md
+{
+namespace tokenizers
+{
+
+using namespace std;
+
+/**
+ * Converts the tokens in to the decoded commands. Does not touch the order
+ * books, so every thread can use its own decoder. Lines which fail the
+ * validation are decoded as COMMAND_INVALID. The reason is kept until the
+ * next line is decoded and is left to the caller to report.
+ */
+class MdDecoder
+{
+public:
+    /**
+     * Constructor
+     * @param quiet if false, numeric conversion failures are reported to
+     *              the error stream at once, as the data objects do it
+     */
+    explicit MdDecoder(bool quiet = true);
+
+    /** Default destructor */
+    ~MdDecoder() = default;
+
+    /**
+     * Is used to decode one line
+     * @param line original text. Is kept in the command
+     * @param tokens of the line
+     * @param command where to store the result
+     * @return true if the line is valid, false otherwise
+     */
+    bool decode(string_view line, const TokenList &tokens, MdCommand &command);
+
+    /**
+     * Is used to get the command which failed the validation last
+     * @return command type. COMMAND_INVALID if the name itself was unknown
+     */
+    MdCommandType failedType() const;
+
+    /**
+     * Is used to get the reason of the last validation failure
+     * @return reason. Empty if the name itself was unknown
+     */
+    string_view errorMessage() const;
+
+private:
+    /**
+     * Is used to remember the failure
+     * @param type of the command which failed
+     * @param obj data object which failed
+     * @return false
+     */
+    bool fail(MdCommandType type, MdCommandData &obj);
+
+    /** Data objects, one per command */
+    OrderAddData order_add_;
+    OrderModifyData order_modify_;
+    OrderCancelData order_cancel_;
+    BboSubscriptionData subscribe_bbo_;
+    BboSubscriptionData unsubscribe_bbo_;
+    VwapSubscriptionData subscribe_vwap_;
+    VwapSubscriptionData unsubscribe_vwap_;
+    PrintData print_;
+    PrintData print_full_;
+
+    /** Command which failed the validation last */
+    MdCommandType failed_type_;
+
+    /** Data object which failed the validation last. Null if none */
+    MdCommandData *failed_;
+
+    PREVENT_COPY(MdDecoder);
+    PREVENT_MOVE(MdDecoder);
+};
+
+} // namespace tokenizers
+} // namespace md
+
+#endif /* md_decoder_hpp */
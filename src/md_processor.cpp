@@ -12,15 +12,8 @@
 #include <iostream>
 
 //Local includes
-#include "order_registry.hpp"
 #include "order_iterator.hpp"
 #include "formatted_print.hpp"
-#include "order_add_data.hpp"
-#include "order_modify_data.hpp"
-#include "order_cancel_data.hpp"
-#include "bbo_subscription_data.hpp"
-#include "vwap_subscription_data.hpp"
-#include "print_data.hpp"
 
 using namespace md::tokenizers;
 using namespace md::processors;
@@ -29,339 +22,274 @@ using namespace md::processors;
 
 namespace
 {
+
+/** Names of the command handlers for the diagnostics. Indexed by MdCommandType */
+const char * const HANDLER_NAMES[] =
+{
+    "MdProcessor::process",
+    "ProcessOrderAdd",
+    "ProcessOrderModify",
+    "ProcessOrderCancel",
+    "ProcessSubscribeBbo",
+    "ProcessUnsubscribeBbo",
+    "ProcessSubscribeVwap",
+    "ProcessUnsubscribeVwap",
+    "ProcessPrint",
+    "ProcessPrintFull"
+};
+
 /**
- * This function implements Order Add command
- * @param tokens for OA command
+ * Is used to start loading the registry entry of the order which the command
+ * is going to look up. Only the slot is computed here, nothing is compared
+ * @param registry order data of the replay
+ * @param command command which will be applied soon
  */
-bool ProcessOrderAdd(const vector<string> &tokens, const string &symbol_to_filter)
+inline void PrefetchOrder(const OrderRegistry &registry, const MdCommand &command)
 {
-    try
+    if (command.type != COMMAND_ORDER_ADD && command.type != COMMAND_ORDER_MODIFY
+        && command.type != COMMAND_ORDER_CANCEL)
     {
-        static OrderAddData obj;
-        obj.processTokens(tokens);
+        return;
+    }
 
-        if (!obj.isProcessed())
-        {
-            cout << "ProcessOrderAdd(): Tokens were not processed successfully. Reason: ["
-                << obj.errorMessage() << "]" << '\n';
-            return false;
-        }
+    registry.getOrdersActive().prefetch(command.order_id);
+}
 
-        uint64_t order_id = obj.getOrderId();
-        const string &symbol = obj.getSymbol();
-        OrderSide side = obj.getSide();
-        uint64_t quantity = obj.getQuantity();
-        double price = obj.getPrice();
+/**
+ * Is used to report the order rejected by the order list. The text is
+ * written straight to the stream, nothing is allocated
+ * @param function name of the reporting function
+ * @param status why the order was rejected
+ * @param order_id order unique identificator
+ */
+void ReportOrderStatus(const char *function, OrderStatus status, uint64_t order_id)
+{
+    cerr << function << "(): OrderProcessException: [";
+    WriteOrderStatus(cerr, status, order_id) << "]" << '\n';
+}
 
-        auto &orders_active = OrderRegistry::get().getOrdersActive();
-        if(orders_active.find(order_id) != orders_active.end())
-        {
-            cout << "ProcessOrderAdd(): Order with id [" << order_id <<
-                "] already exists" << '\n';
-            return false;
-        }
+/**
+ * Is used to check whether or not the updates of the symbol are shown
+ * @param symbol_id id of the updated symbol
+ * @param symbol_to_filter id of the symbol to be shown in output. INVALID_SYMBOL_ID shows all
+ * @return true if shown
+ */
+inline bool IsShown(SymbolId symbol_id, SymbolId symbol_to_filter)
+{
+    return symbol_to_filter == INVALID_SYMBOL_ID || symbol_to_filter == symbol_id;
+}
 
-        auto & symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
+/**
+ * This function applies the decoded Order Add command
+ * @param registry order data of the replay
+ * @param order_id order unique identificator
+ * @param symbol_id id of the order symbol
+ * @param side "Buy" or "Sell"
+ * @param quantity number of shares
+ * @param price for one share in ticks
+ * @param symbol_to_filter id of the symbol to be shown in output
+ */
+bool ApplyOrderAdd(OrderRegistry &registry,
+                   uint64_t order_id,
+                   SymbolId symbol_id,
+                   OrderSide side,
+                   uint64_t quantity,
+                   Price price,
+                   SymbolId symbol_to_filter)
+{
+    auto &orders_active = registry.getOrdersActive();
 
-        auto search = symbol_to_orders.find(symbol);
+    //Single lookup. The entry is taken back if the book rejects the order
+    auto added = orders_active.tryEmplace(order_id);
 
-        if (search != symbol_to_orders.end())
-        {
-            //This symbol is registered
-            search->second->add(order_id, side, quantity, price);
-        }
-        else
-        {
-            //This symbol is not registered. Need to add it
-            auto added_symbol = symbol_to_orders.insert(make_pair(symbol, make_unique<SymbolOrderList>(symbol)));
+    if(!added.second)
+    {
+        cout << "ProcessOrderAdd(): Order with id [" << order_id <<
+            "] already exists" << '\n';
+        return false;
+    }
 
-            if(!added_symbol.second)
-            {
-                cout << "ProcessOrderAdd(): Could not register order with id [" << order_id <<
-                    "] and symbol [" << symbol << "]" << '\n';
-                return false;
-            }
+    auto &order_list = registry.getSymbolToOrdersBind()[symbol_id];
 
-            added_symbol.first->second->add(order_id, side, quantity, price);
-        }
+    if (!order_list)
+    {
+        //This symbol is not registered. Need to add it
+        order_list = make_unique<SymbolOrderList>(registry.getSymbols().name(symbol_id));
+        order_list->setModifyPriority(registry.getModifyPriority());
+    }
 
-        orders_active.insert({order_id, symbol});
+    OrderHandle &handle = *added.first;
+    handle.symbol = symbol_id;
 
-        //Now once we have added a new order, let's print it's updated bbo and vwap
-        if (symbol_to_filter == symbol || symbol_to_filter.empty())
-        {
-            PrintBboInfo(symbol);
-            PrintVwapInfo(symbol);
-        }
+    const OrderStatus status = order_list->tryAdd(order_id, side, quantity, price, handle);
 
-        return true;
-    }
-    catch (OrderProcessException &e)
+    if (status != ORDER_OK)
     {
-        cerr << "ProcessOrderAdd(): OrderProcessException: [" << string(e.what())
-            << "]" << '\n';
+        orders_active.erase(order_id);
+        ReportOrderStatus("ProcessOrderAdd", status, order_id);
         return false;
     }
+
+    //Now once we have added a new order, let's print it's updated bbo and vwap
+    if (IsShown(symbol_id, symbol_to_filter))
+    {
+        PrintBboInfo(registry, symbol_id);
+        PrintVwapInfo(registry, symbol_id);
+    }
+
+    return true;
 }
 
 /**
- * This function implements Order Modify command
- * @param tokens for OM command
+ * This function applies the decoded Order Modify command
+ * @param registry order data of the replay
+ * @param order_id order unique identificator
+ * @param quantity number of shares
+ * @param price for one share in ticks
+ * @param symbol_to_filter id of the symbol to be shown in output
  */
-bool ProcessOrderModify(const vector<string> &tokens, const string &symbol_to_filter)
+bool ApplyOrderModify(OrderRegistry &registry,
+                      uint64_t order_id,
+                      uint64_t quantity,
+                      Price price,
+                      SymbolId symbol_to_filter)
 {
-    try
-    {
-        static OrderModifyData obj;
-        obj.processTokens(tokens);
+    auto &orders_active = registry.getOrdersActive();
+    auto search_for_active = orders_active.find(order_id);
 
-        if (!obj.isProcessed())
-        {
-            cout << "ProcessOrderModify(): Tokens were not processed successfully. Reason: ["
-                << obj.errorMessage() << "]" << '\n';
-            return false;
-        }
-
-        uint64_t order_id = obj.getOrderId();
-        uint64_t quantity = obj.getQuantity();
-        double price = obj.getPrice();
-
-        const auto &orders_active = OrderRegistry::get().getOrdersActive();
-        auto search_for_active = orders_active.find(order_id);
-
-        if( search_for_active == orders_active.end())
-        {
-            cout << "ProcessOrderModify(): Order with such id is not registered in the system ["
-                << order_id << "]" << '\n';
-            return false;
-        }
-
-        const string &symbol = search_for_active->second;
-
-        const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
+    if( search_for_active == nullptr)
+    {
+        cout << "ProcessOrderModify(): Order with such id is not registered in the system ["
+            << order_id << "]" << '\n';
+        return false;
+    }
 
-        auto search = symbol_to_orders.find(symbol);
+    OrderHandle &handle = *search_for_active;
 
-        if (search != symbol_to_orders.end())
-        {
-            //This symbol is registered
-            search->second->modify(order_id, quantity, price);
-
-            //Now once we have modified an order, let's print it's updated bbo and vwap
-            if (symbol_to_filter == symbol || symbol_to_filter.empty())
-            {
-                PrintBboInfo(symbol);
-                PrintVwapInfo(symbol);
-            }
-        }
-        else
-        {
-            cout << "ProcessOrderModify(): The order is present but it's symbol is not registered. Order id:["
-                << order_id << "]. Symbol [" << symbol << "]" << '\n';
-            return false;
-        }
+    const OrderStatus status = registry.findOrderList(handle.symbol)->tryModify(handle, quantity, price);
 
-        return true;
-    }
-    catch (OrderProcessException &e)
+    if (status != ORDER_OK)
     {
-        cerr << "ProcessOrderModify(): OrderProcessException: [" << string(e.what())
-            << "]" << '\n';
+        ReportOrderStatus("ProcessOrderModify", status, order_id);
         return false;
     }
+
+    //Now once we have modified an order, let's print it's updated bbo and vwap
+    if (IsShown(handle.symbol, symbol_to_filter))
+    {
+        PrintBboInfo(registry, handle.symbol);
+        PrintVwapInfo(registry, handle.symbol);
+    }
+
+    return true;
 }
 
 /**
- * This function implements Order Cancel command
- * @param tokens for OC command
+ * This function applies the decoded Order Cancel command
+ * @param registry order data of the replay
+ * @param order_id order unique identificator
+ * @param symbol_to_filter id of the symbol to be shown in output
  */
-bool ProcessOrderCancel(const vector<string> &tokens, const string &symbol_to_filter)
+bool ApplyOrderCancel(OrderRegistry &registry, uint64_t order_id, SymbolId symbol_to_filter)
 {
-    try
-    {
-        static OrderCancelData obj;
-        obj.processTokens(tokens);
-
-        if (!obj.isProcessed())
-        {
-            cout << "ProcessOrderCancel(): Tokens were not processed successfully. Reason: ["
-                << obj.errorMessage() << "]" << '\n';
-            return false;
-        }
+    auto &orders_active = registry.getOrdersActive();
+    auto search_for_active = orders_active.find(order_id);
 
-        uint64_t order_id = obj.getOrderId();
-
-        auto &orders_active = OrderRegistry::get().getOrdersActive();
-        auto search_for_active = orders_active.find(order_id);
-
-        if( search_for_active == orders_active.end())
-        {
-            cout << "ProcessOrderCancel(): Order with such id is not registered in the system ["
-                << order_id << "]" << '\n';
-            return false;
-        }
-
-        const string &symbol = search_for_active->second;
-
-        const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
-
-        auto search = symbol_to_orders.find(symbol);
+    if( search_for_active == nullptr)
+    {
+        cout << "ProcessOrderCancel(): Order with such id is not registered in the system ["
+            << order_id << "]" << '\n';
+        return false;
+    }
 
-        if (search != symbol_to_orders.end())
-        {
-            //This symbol is registered
-            search->second->cancel(order_id);
-
-            //Now once we have canceled an order, let's print it's updated bbo and vwap
-            if (symbol_to_filter == symbol || symbol_to_filter.empty())
-            {
-                PrintBboInfo(symbol);
-                PrintVwapInfo(symbol);
-            }
-        }
-        else
-        {
-            cout << "ProcessOrderCancel(): The order is present but it's symbol is not registered. " <<
-            "Erasing it anyway. Order id:[" << order_id << "]. Symbol [" << symbol << "]" << '\n';
-            //Do not return from here. Since the order is not in the symbol_to_orders anyway
-            //we will just erase it.
-        }
+    const OrderHandle handle = *search_for_active;
 
-        orders_active.erase(search_for_active);
+    registry.findOrderList(handle.symbol)->cancel(handle);
+    orders_active.erase(order_id);
 
-        return true;
-    }
-    catch (OrderProcessException &e)
+    //Now once we have canceled an order, let's print it's updated bbo and vwap
+    if (IsShown(handle.symbol, symbol_to_filter))
     {
-        cerr << "ProcessOrderCancel(): OrderProcessException: [" << string(e.what())
-            << "]" << '\n';
-        return false;
+        PrintBboInfo(registry, handle.symbol);
+        PrintVwapInfo(registry, handle.symbol);
     }
+
+    return true;
 }
 
 /**
- * This function implements Subscribe Bbo command
- * @param tokens for BBO command
- * @param symbol to be shown in output
+ * This function applies the decoded Subscribe Bbo command
+ * @param registry order data of the replay
+ * @param symbol_id id of the symbol to subscribe to
  */
-bool ProcessSubscribeBbo(const vector<string> &tokens, const string &)
+bool ApplySubscribeBbo(OrderRegistry &registry, SymbolId symbol_id)
 {
-    static BboSubscriptionData obj("SUBSCRIBE BBO");
-    obj.processTokens(tokens);
+    auto &subscriber_count = registry.getBboSubscribers()[symbol_id];
 
-    if (!obj.isProcessed())
-    {
-        cout << "ProcessSubscribeBbo(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
-        return false;
-    }
-
-    const string &symbol = obj.getSymbol();
-
-    auto &bbo_subscribers = OrderRegistry::get().getBboSubscribers();
-
-    ++bbo_subscribers[symbol];
+    subscriber_count = subscriber_count.value_or(0) + 1;
 
     return true;
 }
 
 /**
- * This function implements Unsubscribe Bbo command
- * @param tokens for BBO command
- * @param symbol to be shown in output
+ * This function applies the decoded Unsubscribe Bbo command
+ * @param registry order data of the replay
+ * @param symbol to unsubscribe from
  */
-bool ProcessUnsubscribeBbo(const vector<string> &tokens, const string &)
+bool ApplyUnsubscribeBbo(OrderRegistry &registry, string_view symbol)
 {
-    static BboSubscriptionData obj("UNSUBSCRIBE BBO");
-    obj.processTokens(tokens);
+    const SymbolId symbol_id = registry.getSymbols().find(symbol);
 
-    if (!obj.isProcessed())
+    if (symbol_id == INVALID_SYMBOL_ID || !registry.getBboSubscribers()[symbol_id])
     {
-        cout << "ProcessUnsubscribeBbo(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
+        cerr << "ProcessUnsubscribeBbo(): Can't unsubscribe. Where was no subscriptions to this symbol: ["
+            << symbol << "]" << '\n';
         return false;
     }
 
-    const string &symbol = obj.getSymbol();
+    auto &subscriber_count = *registry.getBboSubscribers()[symbol_id];
 
-    try
+    if (subscriber_count > 0)
     {
-        auto &bbo_subscribers = OrderRegistry::get().getBboSubscribers();
-
-        auto &subscriber_count = bbo_subscribers.at(symbol);
-
-        if (subscriber_count > 0)
-        {
-            --subscriber_count;
-        }
-        else
-        {
-            //Do nothing. We are not subscribed to anyone here
-        }
-
-        return true;
+        --subscriber_count;
     }
-    catch (out_of_range &)
+    else
     {
-        cerr << "ProcessUnsubscribeBbo(): Can't unsubscribe. Where was no subscriptions to this symbol: ["
-            << symbol << "]" << '\n';
-        return false;
+        //Do nothing. We are not subscribed to anyone here
     }
+
+    return true;
 }
 
 /**
- * This function implements Subscribe Vwap command
- * @param tokens for VWAP command
- * @param symbol to be shown in output
+ * This function applies the decoded Subscribe Vwap command
+ * @param registry order data of the replay
+ * @param symbol_id id of the symbol to subscribe to
+ * @param quantity number of shares to calculate vwap for
  */
-bool ProcessSubscribeVwap(const vector<string> &tokens, const string &)
+bool ApplySubscribeVwap(OrderRegistry &registry, SymbolId symbol_id, uint64_t quantity)
 {
-    static VwapSubscriptionData obj("SUBSCRIBE VWAP");
-    obj.processTokens(tokens);
-
-    if (!obj.isProcessed())
-    {
-        cout << "ProcessSubscribeVwap(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
-        return false;
-    }
-
-    const string &symbol = obj.getSymbol();
-    uint64_t quantity = obj.getQuantity();
-
     if (quantity == 0)
     {
         cout << "ProcessSubscribeVwap(): Quantity can't be zero" << '\n';
         return false;
     }
 
-    auto &vwap_subscribers = OrderRegistry::get().getVwapSubscribers();
+    auto &vwap_subscribers = registry.getVwapSubscribers();
 
-    ++vwap_subscribers[symbol][quantity];
+    ++vwap_subscribers[symbol_id][quantity];
 
     return true;
 }
 
 /**
- * This function implements Unsubscribe Vwap command
- * @param tokens for VWAP command
- * @param symbol to be shown in output
+ * This function applies the decoded Unsubscribe Vwap command
+ * @param registry order data of the replay
+ * @param symbol to unsubscribe from
+ * @param quantity number of shares vwap was calculated for
  */
-bool ProcessUnsubscribeVwap(const vector<string> &tokens, const string &)
+bool ApplyUnsubscribeVwap(OrderRegistry &registry, string_view symbol, uint64_t quantity)
 {
-    static VwapSubscriptionData obj("UNSUBSCRIBE VWAP");
-    obj.processTokens(tokens);
-
-    if (!obj.isProcessed())
-    {
-        cout << "ProcessUnsubscribeVwap(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
-        return false;
-    }
-
-    const string &symbol = obj.getSymbol();
-    uint64_t quantity = obj.getQuantity();
-
     try
     {
         if (quantity == 0)
@@ -370,9 +298,10 @@ bool ProcessUnsubscribeVwap(const vector<string> &tokens, const string &)
             return false;
         }
 
-        auto &vwap_subscribers = OrderRegistry::get().getVwapSubscribers();
+        auto &vwap_subscribers = registry.getVwapSubscribers();
 
-        auto &subscriber_count = vwap_subscribers.at(symbol).at(quantity);
+        //Unknown symbol is out of range too
+        auto &subscriber_count = vwap_subscribers.at(registry.getSymbols().find(symbol)).at(quantity);
 
         if (subscriber_count > 0)
         {
@@ -394,39 +323,26 @@ bool ProcessUnsubscribeVwap(const vector<string> &tokens, const string &)
 }
 
 /**
- * This function implements Print command
- * @param tokens for PRINT command
- * @param symbol to be shown in output
+ * This function applies the decoded Print command
+ * @param registry order data of the replay
+ * @param symbol_to_print symbol which order book to print
+ * @param symbol_to_filter symbol to be shown in output
  */
-bool ProcessPrint(const vector<string> &tokens, const string &symbol_to_filter)
+bool ApplyPrint(OrderRegistry &registry, string_view symbol_to_print, const string &symbol_to_filter)
 {
-    static PrintData obj("PRINT");
-    obj.processTokens(tokens);
-
-    if (!obj.isProcessed())
-    {
-        cout << "ProcessPrint(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
-        return false;
-    }
-
-    const string &symbol_to_print = obj.getSymbol();
-
     if(symbol_to_print != symbol_to_filter && !symbol_to_filter.empty())
     {
         //Filtered out by the user
         return true;
     }
 
-    const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
-
-    auto search = symbol_to_orders.find(symbol_to_print);
+    SymbolOrderList *order_list = registry.findOrderList(registry.getSymbols().find(symbol_to_print));
 
-    if (search != symbol_to_orders.end())
+    if (order_list != nullptr)
     {
         //This symbol is registered
 
-        PrintPriceLevels(search->second->getIterator(), symbol_to_print);
+        PrintPriceLevels(order_list->bids(), order_list->asks(), order_list->symbol());
     }
     else
     {
@@ -439,39 +355,26 @@ bool ProcessPrint(const vector<string> &tokens, const string &symbol_to_filter)
 }
 
 /**
- * This function implements Print all command
- * @param tokens for PRINT_ALL command
- * @param symbol to be shown in output
+ * This function applies the decoded Print all command
+ * @param registry order data of the replay
+ * @param symbol_to_print symbol which order list to print
+ * @param symbol_to_filter symbol to be shown in output
  */
-bool ProcessPrintFull(const vector<string> &tokens, const string &symbol_to_filter)
+bool ApplyPrintFull(OrderRegistry &registry, string_view symbol_to_print, const string &symbol_to_filter)
 {
-    static PrintData obj("PRINT_FULL");
-    obj.processTokens(tokens);
-
-    if (!obj.isProcessed())
-    {
-        cout << "ProcessPrintFull(): Tokens were not processed successfully. Reason: ["
-            << obj.errorMessage() << "]" << '\n';
-        return false;
-    }
-
-    const string &symbol_to_print = obj.getSymbol();
-
     if(symbol_to_print != symbol_to_filter && !symbol_to_filter.empty())
     {
         //Filtered out by the user
         return true;
     }
 
-    const auto &symbol_to_orders = OrderRegistry::get().getSymbolToOrdersBind();
+    SymbolOrderList *order_list = registry.findOrderList(registry.getSymbols().find(symbol_to_print));
 
-    auto search = symbol_to_orders.find(symbol_to_print);
-
-    if (search != symbol_to_orders.end())
+    if (order_list != nullptr)
     {
         //This symbol is registered
 
-        PrintFullOrderList(search->second->getIterator(), symbol_to_print);
+        PrintFullOrderList(order_list->getIterator(), order_list->symbol());
     }
     else
     {
@@ -483,29 +386,129 @@ bool ProcessPrintFull(const vector<string> &tokens, const string &symbol_to_filt
     return true;
 }
 
+/** What the strict filter sees in the line */
+enum LinePrefix
+{
+    PREFIX_OTHER,
+    PREFIX_ORDER_ADD,
+    PREFIX_ORDER_MODIFY,
+    PREFIX_ORDER_CANCEL
+};
+
+/** Raw fields of the line which the strict filter needs */
+struct LineFields
+{
+    string_view order_id;
+    string_view symbol;
+    string_view side;
+    string_view quantity;
+    string_view price;
+};
+
+/**
+ * Is used to find the fields which the strict filter needs without the full
+ * tokenizing. Fields have to be non empty, otherwise the tokenizer would skip
+ * them and the tokens would not match the raw fields
+ * @param line raw line
+ * @param fields where to store the fields. Only the order id for the updates
+ * @return kind of the line. PREFIX_OTHER if the fields can't be found
+ */
+LinePrefix SplitLinePrefix(string_view line, LineFields &fields)
+{
+    static const string_view ORDER_ADD = "ORDER ADD,";
+    static const string_view ORDER_MODIFY = "ORDER MODIFY,";
+    static const string_view ORDER_CANCEL = "ORDER CANCEL,";
+
+    LinePrefix prefix = PREFIX_OTHER;
+
+    if (line.substr(0, ORDER_ADD.size()) == ORDER_ADD)
+    {
+        prefix = PREFIX_ORDER_ADD;
+        line.remove_prefix(ORDER_ADD.size());
+    }
+    else if (line.substr(0, ORDER_MODIFY.size()) == ORDER_MODIFY)
+    {
+        prefix = PREFIX_ORDER_MODIFY;
+        line.remove_prefix(ORDER_MODIFY.size());
+    }
+    else if (line.substr(0, ORDER_CANCEL.size()) == ORDER_CANCEL)
+    {
+        prefix = PREFIX_ORDER_CANCEL;
+        line.remove_prefix(ORDER_CANCEL.size());
+    }
+    else
+    {
+        return PREFIX_OTHER;
+    }
+
+    if (prefix != PREFIX_ORDER_ADD)
+    {
+        fields.order_id = line.substr(0, line.find(','));
+        return fields.order_id.empty() ? PREFIX_OTHER : prefix;
+    }
+
+    //Order Add must have exactly five non empty fields left
+    string_view *add_fields[] = { &fields.order_id, &fields.symbol, &fields.side,
+        &fields.quantity, &fields.price };
+
+    for (string_view *field : add_fields)
+    {
+        if (line.data() == nullptr)
+        {
+            return PREFIX_OTHER;
+        }
+
+        const size_t comma = line.find(',');
+        *field = line.substr(0, comma);
+
+        if (field->empty())
+        {
+            return PREFIX_OTHER;
+        }
+
+        line = comma == string_view::npos ? string_view() : line.substr(comma + 1);
+    }
+
+    return line.data() == nullptr ? prefix : PREFIX_OTHER;
+}
+
+/**
+ * Is used to check whether or not the order books would accept the Order Add
+ * @param side of the order
+ * @param quantity of the order
+ * @param price of the order
+ * @return true if the order would be added
+ */
+inline bool IsAcceptableOrder(OrderSide side, uint64_t quantity, Price price)
+{
+    return side != OrderSide::UNKNOWN && quantity != 0 && price >= 0;
+}
+
 } // namespace
 
 /*************************** MdProcessor *******************************/
 
 MdProcessor::MdProcessor() :
-    handlers_
-    {
-        { "ORDER ADD", ProcessOrderAdd },
-        { "ORDER MODIFY", ProcessOrderModify },
-        { "ORDER CANCEL", ProcessOrderCancel },
-        { "SUBSCRIBE BBO", ProcessSubscribeBbo },
-        { "UNSUBSCRIBE BBO", ProcessUnsubscribeBbo },
-        { "SUBSCRIBE VWAP", ProcessSubscribeVwap },
-        { "UNSUBSCRIBE VWAP", ProcessUnsubscribeVwap },
-        { "PRINT", ProcessPrint },
-        { "PRINT_FULL", ProcessPrintFull }
-    }
+    decoder_(false),
+    symbol_id_(INVALID_SYMBOL_ID),
+    strict_(false)
+{
+}
+
+OrderRegistry & MdProcessor::getRegistry()
 {
+    return registry_;
+}
+
+const OrderRegistry & MdProcessor::getRegistry() const
+{
+    return registry_;
 }
 
 void MdProcessor::setFilter(const string &val)
 {
     symbol_ = val;
+    symbol_id_ = val.empty() ? INVALID_SYMBOL_ID : registry_.internSymbol(val);
 }
 
 const string & MdProcessor::getFilter() const
@@ -513,24 +516,296 @@ const string & MdProcessor::getFilter() const
     return symbol_;
 }
 
-bool MdProcessor::process(const vector<string> &tokens)
+void MdProcessor::setStrictFilter(bool val)
 {
-    try
+    strict_ = val;
+}
+
+bool MdProcessor::isStrictFilter() const
+{
+    return strict_ && !symbol_.empty();
+}
+
+MdProcessor::FilterVerdict MdProcessor::filterLine(string_view line, uint64_t &order_id)
+{
+    if (!isStrictFilter())
+    {
+        return FILTER_PASS;
+    }
+
+    LineFields fields;
+    const LinePrefix prefix = SplitLinePrefix(line, fields);
+
+    if (prefix == PREFIX_OTHER || ParseUnsigned(fields.order_id, order_id) != PARSE_OK)
+    {
+        //Let the usual processing deal with it
+        return FILTER_PASS;
+    }
+
+    if (prefix != PREFIX_ORDER_ADD)
     {
-        if (!tokens.empty())
+        return filterOrderUpdate(order_id, prefix == PREFIX_ORDER_CANCEL);
+    }
+
+    OrderSide side = OrderSide::UNKNOWN;
+
+    if (fields.side == "Buy")
+    {
+        side = OrderSide::BUY;
+    }
+    else if (fields.side == "Sell")
+    {
+        side = OrderSide::SELL;
+    }
+
+    uint64_t quantity = 0;
+    Price price = -1;
+
+    //Parsing errors are reported before anything else
+    if (side == OrderSide::UNKNOWN
+        || ParseUnsigned(fields.quantity, quantity) != PARSE_OK
+        || ParsePrice(fields.price, price) != PARSE_OK)
+    {
+        return FILTER_PASS;
+    }
+
+    return filterOrderAdd(order_id, fields.symbol, side, quantity, price);
+}
+
+MdProcessor::FilterVerdict MdProcessor::filterOrderAdd(uint64_t order_id, string_view symbol,
+                                                       OrderSide side, uint64_t quantity, Price price)
+{
+    if (!isStrictFilter())
+    {
+        return FILTER_PASS;
+    }
+
+    if (dropped_orders_.contains(order_id))
+    {
+        //Id is still taken by the dropped order
+        return FILTER_DUPLICATE;
+    }
+
+    //Only the orders which the books would take are dropped. The rest goes
+    //through the usual processing to get the same diagnostics and books
+    if (symbol == symbol_ || !IsAcceptableOrder(side, quantity, price)
+        || registry_.getOrdersActive().contains(order_id))
+    {
+        return FILTER_PASS;
+    }
+
+    dropped_orders_.insert(order_id);
+    return FILTER_DROP;
+}
+
+MdProcessor::FilterVerdict MdProcessor::filterOrderUpdate(uint64_t order_id, bool cancel)
+{
+    if (!isStrictFilter() || !dropped_orders_.contains(order_id))
+    {
+        return FILTER_PASS;
+    }
+
+    if (cancel)
+    {
+        dropped_orders_.erase(order_id);
+    }
+
+    return FILTER_DROP;
+}
+
+bool MdProcessor::applyVerdict(FilterVerdict verdict, uint64_t order_id)
+{
+    if (verdict == FILTER_DUPLICATE)
+    {
+        //Same as the books would report it
+        cout << "ProcessOrderAdd(): Order with id [" << order_id <<
+            "] already exists" << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool MdProcessor::process(const TokenList &tokens)
+{
+    if (tokens.empty())
+    {
+        cout << "MdProcessor::process(): Provided array of tokens is empty. Ignoring" << '\n';
+        return false;
+    }
+
+    MdCommand command;
+
+    if (!decoder_.decode(string_view(), tokens, command))
+    {
+        reportInvalid(tokens);
+        return false;
+    }
+
+    return apply(command);
+}
+
+void MdProcessor::reportInvalid(const TokenList &tokens)
+{
+    const MdCommandType type = decoder_.failedType();
+
+    if (type == COMMAND_INVALID)
+    {
+        cerr << "MdProcessor::process(): Unknown command [" << tokens[MdCommandData::COMMAND_NAME] << "]" << '\n';
+        return;
+    }
+
+    cout << HANDLER_NAMES[type] << "(): Tokens were not processed successfully. Reason: ["
+        << decoder_.errorMessage() << "]" << '\n';
+}
+
+bool MdProcessor::process(string_view line)
+{
+    Tokenize(line, ',', tokens_);
+    return process(tokens_);
+}
+
+bool MdProcessor::processFiltered(string_view line)
+{
+    uint64_t order_id = 0;
+    const FilterVerdict verdict = filterLine(line, order_id);
+
+    if (verdict != FILTER_PASS)
+    {
+        return applyVerdict(verdict, order_id);
+    }
+
+    return process(line);
+}
+
+bool MdProcessor::processFiltered(string_view line, const TokenList &tokens)
+{
+    uint64_t order_id = 0;
+    const FilterVerdict verdict = filterLine(line, order_id);
+
+    if (verdict != FILTER_PASS)
+    {
+        return applyVerdict(verdict, order_id);
+    }
+
+    return process(tokens);
+}
+
+bool MdProcessor::apply(const MdCommand &command)
+{
+    switch (command.type)
+    {
+        case COMMAND_ORDER_ADD:
+            return orderAdd(command.order_id, command.symbol, command.side, command.quantity, command.price);
+        case COMMAND_ORDER_MODIFY:
+            return orderModify(command.order_id, command.quantity, command.price);
+        case COMMAND_ORDER_CANCEL:
+            return orderCancel(command.order_id);
+        case COMMAND_SUBSCRIBE_BBO:
+            return subscribeBbo(command.symbol);
+        case COMMAND_UNSUBSCRIBE_BBO:
+            return unsubscribeBbo(command.symbol);
+        case COMMAND_SUBSCRIBE_VWAP:
+            return subscribeVwap(command.symbol, command.quantity);
+        case COMMAND_UNSUBSCRIBE_VWAP:
+            return unsubscribeVwap(command.symbol, command.quantity);
+        case COMMAND_PRINT:
+            return print(command.symbol);
+        case COMMAND_PRINT_FULL:
+            return printFull(command.symbol);
+        default:
+            //Validation failed. Rerun it here to get the diagnostics in order
+            return processFiltered(command.line);
+    }
+}
+
+size_t MdProcessor::processBatch(const MdCommand *commands, size_t count, const BatchFailureHandler &on_failure)
+{
+    size_t processed = 0;
+
+    for (size_t i = 0; i < count && i < PREFETCH_DISTANCE; ++i)
+    {
+        PrefetchOrder(registry_, commands[i]);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i + PREFETCH_DISTANCE < count)
         {
-            return handlers_.at(tokens[MdCommandData::COMMAND_NAME])(tokens, getFilter());
+            PrefetchOrder(registry_, commands[i + PREFETCH_DISTANCE]);
         }
-        else
+
+        if (apply(commands[i]))
         {
-            cout << "MdProcessor::process(): Provided array of tokens is empty. Ignoring" << '\n';
-            return false;
+            ++processed;
+        }
+        else if (on_failure)
+        {
+            on_failure(commands[i]);
         }
     }
-    catch (out_of_range &e)
+
+    return processed;
+}
+
+bool MdProcessor::orderAdd(uint64_t order_id, string_view symbol, OrderSide side, uint64_t quantity, Price price)
+{
+    const FilterVerdict verdict = filterOrderAdd(order_id, symbol, side, quantity, price);
+
+    if (verdict != FILTER_PASS)
     {
-        cerr << "MdProcessor::process(): bad key for handler map. Exception: ["
-            << string(e.what()) << "]" << '\n';
-        return false;
+        return applyVerdict(verdict, order_id);
+    }
+
+    return ApplyOrderAdd(registry_, order_id, registry_.internSymbol(symbol), side, quantity, price, symbol_id_);
+}
+
+bool MdProcessor::orderModify(uint64_t order_id, uint64_t quantity, Price price)
+{
+    if (filterOrderUpdate(order_id, false) != FILTER_PASS)
+    {
+        return true;
     }
+
+    return ApplyOrderModify(registry_, order_id, quantity, price, symbol_id_);
+}
+
+bool MdProcessor::orderCancel(uint64_t order_id)
+{
+    if (filterOrderUpdate(order_id, true) != FILTER_PASS)
+    {
+        return true;
+    }
+
+    return ApplyOrderCancel(registry_, order_id, symbol_id_);
+}
+
+bool MdProcessor::subscribeBbo(string_view symbol)
+{
+    return ApplySubscribeBbo(registry_, registry_.internSymbol(symbol));
+}
+
+bool MdProcessor::unsubscribeBbo(string_view symbol)
+{
+    return ApplyUnsubscribeBbo(registry_, symbol);
+}
+
+bool MdProcessor::subscribeVwap(string_view symbol, uint64_t quantity)
+{
+    return ApplySubscribeVwap(registry_, registry_.internSymbol(symbol), quantity);
+}
+
+bool MdProcessor::unsubscribeVwap(string_view symbol, uint64_t quantity)
+{
+    return ApplyUnsubscribeVwap(registry_, symbol, quantity);
+}
+
+bool MdProcessor::print(string_view symbol)
+{
+    return ApplyPrint(registry_, symbol, getFilter());
+}
+
+bool MdProcessor::printFull(string_view symbol)
+{
+    return ApplyPrintFull(registry_, symbol, getFilter());
 }
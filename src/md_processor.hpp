@@ -10,13 +10,21 @@
 #define md_processor_hpp
 
 //System includes
-#include <unordered_map>
-#include <string>
-#include <vector>
+#include <cstddef>
 #include <functional>
+#include <string>
+#include <string_view>
 
 //Local includes
 #include "defines.h"
+#include "tokenizer.hpp"
+#include "md_command.hpp"
+#include "md_decoder.hpp"
+#include "container_definitions.hpp"
+#include "price.hpp"
+#include "order_id_set.hpp"
+#include "symbol_table.hpp"
+#include "order_registry.hpp"
 
 namespace md
 {
@@ -24,14 +32,23 @@ namespace processors
 {
 
 using namespace std;
+using md::tokenizers::TokenList;
+using md::tokenizers::MdCommand;
+using md::tokenizers::MdDecoder;
 
 /**
- * Market data processor class. Is used to process the tokens in to the
- * commands and execute them
+ * Market data processor class. Is used to decode the tokens in to the
+ * commands and execute them. Owns the order data of its replay, so
+ * processors are independent of each other
  */
 class MdProcessor
 {
 public:
+    /** Is called for every command of the batch which was not processed */
+    using BatchFailureHandler = function<void(const MdCommand &command)>;
+
+    /** How many commands ahead of the current one the orders are prefetched */
+    static constexpr size_t PREFETCH_DISTANCE = 8;
 
     /** Default constructor */
     MdProcessor();
@@ -39,6 +56,18 @@ public:
     /** Default destructor */
     ~MdProcessor() = default;
 
+    /**
+     * Is used to get the order data of this replay
+     * @return registry of this processor
+     */
+    OrderRegistry & getRegistry();
+
+    /**
+     * Same as above, but read only
+     * @return registry of this processor
+     */
+    const OrderRegistry & getRegistry() const;
+
     /**
      * Is used to set the symbol for print filtering
      * @param val symbol to show in output
@@ -51,26 +80,217 @@ public:
      */
     const string & getFilter() const;
 
+    /**
+     * Is used to enable the strict filtering. Orders of the other symbols are
+     * dropped before they reach the books and the later updates of the dropped
+     * orders are skipped silently. Has no effect without the filter symbol
+     * @param val true to enable
+     */
+    void setStrictFilter(bool val);
+
+    /**
+     * Is used to check whether or not the strict filtering is active
+     * @return true if active
+     */
+    bool isStrictFilter() const;
+
     /**
      * Main routine for processing the tokens in to commands
      * @param tokens what to be processed
      * @return true if the processing was successfull false otherwise
      */
-    bool process(const vector<string> &tokens);
+    bool process(const TokenList &tokens);
+
+    /**
+     * Splits the line in to tokens and processes them. Tokens are the views
+     * in to the line, nothing is copied
+     * @param line what to be processed
+     * @return true if the processing was successfull false otherwise
+     */
+    bool process(string_view line);
+
+    /**
+     * Same as above, but the raw line is checked against the strict filter
+     * first. Only the fields up to the symbol or the order id are looked at,
+     * dropped lines are not tokenized at all
+     * @param line what to be processed
+     * @return true if the processing was successfull or the line was dropped
+     */
+    bool processFiltered(string_view line);
+
+    /**
+     * Same as above for the line which is already tokenized
+     * @param line what to be processed
+     * @param tokens of the line
+     * @return true if the processing was successfull or the line was dropped
+     */
+    bool processFiltered(string_view line, const TokenList &tokens);
+
+    /**
+     * Is used to apply the decoded command. Invalid commands are processed from
+     * their original line, so the diagnostics are the same as for process()
+     * @param command decoded command
+     * @return true if the processing was successfull false otherwise
+     */
+    bool apply(const MdCommand &command);
+
+    /**
+     * Is used to apply the block of the decoded commands in order. While one
+     * command is applied, the order lookups of the commands further in the
+     * block are prefetched
+     * @param commands first command of the block
+     * @param count number of the commands in the block
+     * @param on_failure is called for every command which was not processed
+     * @return number of the commands processed successfully
+     */
+    size_t processBatch(const MdCommand *commands, size_t count, const BatchFailureHandler &on_failure);
+
+    /**
+     * Applies the already decoded Order Add command. Orders dropped by the
+     * strict filter are skipped and reported as processed
+     * @param order_id order unique identificator
+     * @param symbol of the order
+     * @param side "Buy" or "Sell"
+     * @param quantity number of shares
+     * @param price for one share
+     * @return true if the processing was successfull false otherwise
+     */
+    bool orderAdd(uint64_t order_id, string_view symbol, OrderSide side, uint64_t quantity, Price price);
+
+    /**
+     * Applies the already decoded Order Modify command. Updates of the orders
+     * dropped by the strict filter are skipped and reported as processed
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share
+     * @return true if the processing was successfull false otherwise
+     */
+    bool orderModify(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Applies the already decoded Order Cancel command. Same as above
+     * @param order_id order unique identificator
+     * @return true if the processing was successfull false otherwise
+     */
+    bool orderCancel(uint64_t order_id);
+
+    /**
+     * Applies the already decoded Subscribe Bbo command
+     * @param symbol to subscribe to
+     * @return true if the processing was successfull false otherwise
+     */
+    bool subscribeBbo(string_view symbol);
+
+    /**
+     * Applies the already decoded Unsubscribe Bbo command
+     * @param symbol to unsubscribe from
+     * @return true if the processing was successfull false otherwise
+     */
+    bool unsubscribeBbo(string_view symbol);
+
+    /**
+     * Applies the already decoded Subscribe Vwap command
+     * @param symbol to subscribe to
+     * @param quantity number of shares to calculate vwap for
+     * @return true if the processing was successfull false otherwise
+     */
+    bool subscribeVwap(string_view symbol, uint64_t quantity);
+
+    /**
+     * Applies the already decoded Unsubscribe Vwap command
+     * @param symbol to unsubscribe from
+     * @param quantity number of shares vwap was calculated for
+     * @return true if the processing was successfull false otherwise
+     */
+    bool unsubscribeVwap(string_view symbol, uint64_t quantity);
+
+    /**
+     * Applies the already decoded Print command
+     * @param symbol which order book to print
+     * @return true if the processing was successfull false otherwise
+     */
+    bool print(string_view symbol);
+
+    /**
+     * Applies the already decoded Print all command
+     * @param symbol which order list to print
+     * @return true if the processing was successfull false otherwise
+     */
+    bool printFull(string_view symbol);
 
 protected:
-    /** Token handler definition */
-    using MdHandler = function<bool(const vector<string> &, const string &)>;
+    /** Decision of the strict filter */
+    enum FilterVerdict
+    {
+        FILTER_PASS,
+        FILTER_DROP,
+        FILTER_DUPLICATE
+    };
 
-    /** Handler map definition */
-    using MdHandlerMap = unordered_map<string, MdHandler>;
+    /**
+     * Is used to check the raw line against the strict filter
+     * @param line raw line
+     * @param order_id where to store the order id if the line has one
+     * @return what to do with the line
+     */
+    FilterVerdict filterLine(string_view line, uint64_t &order_id);
 
-    /** Holds the handlers */
-    const MdHandlerMap handlers_;
+    /**
+     * Same as above for the decoded Order Add. Only the orders which the books
+     * would accept are dropped, their ids are remembered
+     * @param order_id order unique identificator
+     * @param symbol of the order
+     * @param side of the order
+     * @param quantity of the order
+     * @param price of the order in ticks
+     * @return what to do with the order
+     */
+    FilterVerdict filterOrderAdd(uint64_t order_id, string_view symbol,
+                                 OrderSide side, uint64_t quantity, Price price);
+
+    /**
+     * Same as above for the decoded Order Modify and Order Cancel
+     * @param order_id order unique identificator
+     * @param cancel true for the Order Cancel. Dropped order is forgotten
+     * @return what to do with the order
+     */
+    FilterVerdict filterOrderUpdate(uint64_t order_id, bool cancel);
+
+    /**
+     * Is used to execute the verdict which is not FILTER_PASS
+     * @param verdict of the filter
+     * @param order_id order unique identificator
+     * @return true for the dropped order, false for the duplicate
+     */
+    bool applyVerdict(FilterVerdict verdict, uint64_t order_id);
+
+    /**
+     * Is used to report why the tokens were not decoded
+     * @param tokens of the line. Must not be empty
+     */
+    void reportInvalid(const TokenList &tokens);
+
+    /** Order books, active orders and subscriptions of this replay */
+    OrderRegistry registry_;
+
+    /** Turns the tokens in to the commands. Reports the numeric failures */
+    MdDecoder decoder_;
 
     /** Holds the symbol to show in the output */
     string symbol_;
 
+    /** Id of the symbol to show. INVALID_SYMBOL_ID if everything is shown */
+    SymbolId symbol_id_;
+
+    /** Holds the tokens of the line which is being processed */
+    TokenList tokens_;
+
+    /** Is set if the strict filtering is active */
+    bool strict_;
+
+    /** Ids of the live orders dropped by the strict filter */
+    OrderIdSet dropped_orders_;
+
 private:
     PREVENT_COPY(MdProcessor);
     PREVENT_MOVE(MdProcessor);
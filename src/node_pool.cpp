@@ -0,0 +1,88 @@
+//
+//  node_pool.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 16.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "node_pool.hpp"
+
+//System includes
+#include <algorithm>
+#include <cstddef>
+
+//Local includes
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Alignment of every node. Same as the heap gives */
+const size_t NODE_ALIGNMENT = alignof(max_align_t);
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+void * NodePool::allocate(size_t size)
+{
+    if (node_size_ == 0)
+    {
+        node_size_ = size;
+        stride_ = (max(size, sizeof(FreeNode)) + NODE_ALIGNMENT - 1) / NODE_ALIGNMENT * NODE_ALIGNMENT;
+    }
+    else if (size != node_size_)
+    {
+        return ::operator new(size);
+    }
+
+    if (free_ != nullptr)
+    {
+        FreeNode *node = free_;
+        free_ = node->next;
+        return node;
+    }
+
+    if (chunk_next_ == chunk_end_)
+    {
+        grow();
+    }
+
+    void *node = chunk_next_;
+    chunk_next_ += stride_;
+    return node;
+}
+
+void NodePool::deallocate(void *node, size_t size)
+{
+    if (size != node_size_)
+    {
+        ::operator delete(node);
+        return;
+    }
+
+    free_ = new (node) FreeNode{free_};
+}
+
+size_t NodePool::nodeSize() const
+{
+    return node_size_;
+}
+
+size_t NodePool::chunkCount() const
+{
+    return chunks_.size();
+}
+
+void NodePool::grow()
+{
+    const size_t nodes = chunk_nodes_;
+
+    chunks_.emplace_back(new char[nodes * stride_]);
+    chunk_next_ = chunks_.back().get();
+    chunk_end_ = chunk_next_ + nodes * stride_;
+
+    chunk_nodes_ = max(min(nodes * 2, CHUNK_BYTES / stride_), nodes);
+}
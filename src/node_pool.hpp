@@ -0,0 +1,192 @@
+//
+//  node_pool.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 16.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef node_pool_hpp
+#define node_pool_hpp
+
+//System includes
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+
+using namespace std;
+
+/**
+ * Pool of the fixed size nodes. Nodes are cut from the contiguous chunks
+ * and the freed ones are reused first, so the steady add and cancel flow
+ * does not reach the heap. Size of the node is taken from the first
+ * allocation, the other sizes go to the heap. Chunks are given back only
+ * when the pool is destroyed. Is not thread safe
+ */
+class NodePool final
+{
+public:
+    /** Number of the nodes in the first chunk. Every next chunk is twice as big */
+    static constexpr size_t FIRST_CHUNK_NODES = 32;
+
+    /** Size of the biggest chunk in bytes */
+    static constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+    /** Default constructor */
+    NodePool() = default;
+
+    /** Default destructor. All the nodes are freed with the chunks */
+    ~NodePool() = default;
+
+    /**
+     * Is used to get the memory for one node
+     * @param size of the node in bytes
+     * @return memory of the node
+     */
+    void * allocate(size_t size);
+
+    /**
+     * Is used to give the node back to the pool
+     * @param node memory returned by allocate
+     * @param size same as was passed to allocate
+     */
+    void deallocate(void *node, size_t size);
+
+    /**
+     * Is used to get the size of the nodes of this pool
+     * @return size in bytes. Zero until the first allocation
+     */
+    size_t nodeSize() const;
+
+    /**
+     * Is used to get the number of the chunks taken from the heap
+     * @return number of the chunks
+     */
+    size_t chunkCount() const;
+
+private:
+    /** Freed node. Its memory holds the link to the next one */
+    struct FreeNode
+    {
+        FreeNode *next;
+    };
+
+    /**
+     * Is used to take the new chunk from the heap
+     */
+    void grow();
+
+    /** Size of the nodes as requested */
+    size_t node_size_ = 0;
+
+    /** Distance between the nodes in the chunk */
+    size_t stride_ = 0;
+
+    /** Number of the nodes in the next chunk */
+    size_t chunk_nodes_ = FIRST_CHUNK_NODES;
+
+    /** Most recently freed node */
+    FreeNode *free_ = nullptr;
+
+    /** First node of the current chunk which was never used */
+    char *chunk_next_ = nullptr;
+
+    /** End of the current chunk */
+    char *chunk_end_ = nullptr;
+
+    /** All the chunks of this pool */
+    vector<unique_ptr<char[]>> chunks_;
+
+    PREVENT_COPY(NodePool);
+    PREVENT_MOVE(NodePool);
+};
+
+/**
+ * Standard allocator on top of the NodePool. Single nodes of the node based
+ * containers come from the pool, everything else goes to the heap. Copies
+ * and rebinds share the pool, which has to outlive the container
+ */
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    /**
+     * Constructor
+     * @param pool where to take the nodes from
+     */
+    explicit PoolAllocator(NodePool *pool) noexcept :
+        pool_(pool)
+    {
+    }
+
+    /** Rebind constructor */
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &other) noexcept :
+        pool_(other.pool())
+    {
+    }
+
+    /**
+     * Is used to get the memory for the objects
+     * @param count number of the objects
+     * @return memory of the objects
+     */
+    T * allocate(size_t count)
+    {
+        if (count == 1)
+        {
+            return static_cast<T *>(pool_->allocate(sizeof(T)));
+        }
+
+        return static_cast<T *>(::operator new(count * sizeof(T)));
+    }
+
+    /**
+     * Is used to give the memory back
+     * @param objects memory returned by allocate
+     * @param count same as was passed to allocate
+     */
+    void deallocate(T *objects, size_t count) noexcept
+    {
+        if (count == 1)
+        {
+            pool_->deallocate(objects, sizeof(T));
+            return;
+        }
+
+        ::operator delete(objects);
+    }
+
+    /**
+     * Is used to get the pool of this allocator
+     * @return pool
+     */
+    NodePool * pool() const noexcept
+    {
+        return pool_;
+    }
+
+private:
+    /** Where the nodes come from */
+    NodePool *pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T> &lhs, const PoolAllocator<U> &rhs) noexcept
+{
+    return lhs.pool() == rhs.pool();
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T> &lhs, const PoolAllocator<U> &rhs) noexcept
+{
+    return lhs.pool() != rhs.pool();
+}
+
+#endif /* node_pool_hpp */
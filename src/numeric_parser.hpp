@@ -0,0 +1,237 @@
+//
+//  numeric_parser.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 06.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef numeric_parser_hpp
+#define numeric_parser_hpp
+
+//System includes
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+//Local includes
+#include "price.hpp"
+
+namespace md
+{
+namespace tokenizers
+{
+
+using namespace std;
+
+/**
+ * Result of the numeric field parsing. Parsers never throw, the value is
+ * left untouched unless PARSE_OK is returned
+ */
+enum ParseStatus
+{
+    PARSE_OK,
+    PARSE_EMPTY,
+    PARSE_INVALID,
+    PARSE_OVERFLOW,
+    PARSE_TOO_PRECISE
+};
+
+/**
+ * Is used to get the human readable description of the parsing status
+ * @param status to describe
+ * @return string literal
+ */
+inline const char * ParseStatusMessage(ParseStatus status)
+{
+    switch (status)
+    {
+        case PARSE_OK:          return "Success";
+        case PARSE_EMPTY:       return "Empty number";
+        case PARSE_INVALID:     return "Invalid character";
+        case PARSE_OVERFLOW:    return "Out of range";
+        case PARSE_TOO_PRECISE: return "Too many decimal digits";
+    }
+
+    return "Unknown status";
+}
+
+/**
+ * Parses the decimal unsigned integer. Only the digits are accepted: no sign,
+ * no spaces, no locale specifics
+ * @param begin first character of the number
+ * @param end past the last character of the number
+ * @param value where to store the result
+ * @return parsing status
+ */
+inline ParseStatus ParseUnsigned(const char *begin, const char *end, uint64_t &value)
+{
+    if (begin == end)
+    {
+        return PARSE_EMPTY;
+    }
+
+    //Up to 19 digits always fit in to uint64_t, so no overflow checks for them
+    const size_t safe_digits = numeric_limits<uint64_t>::digits10;
+
+    uint64_t result = 0;
+    const char *current = begin;
+    const char *safe_end = (end - begin > static_cast<ptrdiff_t>(safe_digits)) ? begin + safe_digits : end;
+
+    for (; current != safe_end; ++current)
+    {
+        const unsigned digit = static_cast<unsigned char>(*current) - '0';
+
+        if (digit > 9)
+        {
+            return PARSE_INVALID;
+        }
+
+        result = result * 10 + digit;
+    }
+
+    for (; current != end; ++current)
+    {
+        const unsigned digit = static_cast<unsigned char>(*current) - '0';
+
+        if (digit > 9)
+        {
+            return PARSE_INVALID;
+        }
+
+        if (result > (numeric_limits<uint64_t>::max() - digit) / 10)
+        {
+            return PARSE_OVERFLOW;
+        }
+
+        result = result * 10 + digit;
+    }
+
+    value = result;
+    return PARSE_OK;
+}
+
+/**
+ * Same as above for the token
+ * @param token what to parse
+ * @param value where to store the result
+ * @return parsing status
+ */
+inline ParseStatus ParseUnsigned(string_view token, uint64_t &value)
+{
+    return ParseUnsigned(token.data(), token.data() + token.size(), value);
+}
+
+/**
+ * Parses the decimal price in to the fixed point ticks exactly. Accepted
+ * format is [-]digits[.digits] where one of the digit groups may be empty.
+ * Decimal digits past PRICE_DECIMALS are accepted only if they are zeros
+ * @param begin first character of the price
+ * @param end past the last character of the price
+ * @param price where to store the result
+ * @return parsing status
+ */
+inline ParseStatus ParsePrice(const char *begin, const char *end, Price &price)
+{
+    const char *current = begin;
+    bool negative = false;
+
+    if (current != end && *current == '-')
+    {
+        negative = true;
+        ++current;
+    }
+
+    //Largest integer part which still leaves room for any fraction
+    const Price max_units = (numeric_limits<Price>::max() - (PRICE_SCALE - 1)) / PRICE_SCALE;
+
+    Price units = 0;
+    bool has_digits = false;
+
+    for (; current != end && *current != '.'; ++current)
+    {
+        const unsigned digit = static_cast<unsigned char>(*current) - '0';
+
+        if (digit > 9)
+        {
+            return PARSE_INVALID;
+        }
+
+        if (units > (max_units - digit) / 10)
+        {
+            return PARSE_OVERFLOW;
+        }
+
+        units = units * 10 + digit;
+        has_digits = true;
+    }
+
+    Price fraction = 0;
+    int decimals = 0;
+    bool too_precise = false;
+
+    if (current != end)
+    {
+        //Skip the point
+        ++current;
+
+        for (; current != end; ++current)
+        {
+            const unsigned digit = static_cast<unsigned char>(*current) - '0';
+
+            if (digit > 9)
+            {
+                return PARSE_INVALID;
+            }
+
+            has_digits = true;
+
+            if (decimals < PRICE_DECIMALS)
+            {
+                fraction = fraction * 10 + digit;
+                ++decimals;
+            }
+            else if (digit != 0)
+            {
+                //Keep going. Invalid characters are reported first
+                too_precise = true;
+            }
+        }
+    }
+
+    if (!has_digits)
+    {
+        return (begin == end) ? PARSE_EMPTY : PARSE_INVALID;
+    }
+
+    if (too_precise)
+    {
+        return PARSE_TOO_PRECISE;
+    }
+
+    for (; decimals < PRICE_DECIMALS; ++decimals)
+    {
+        fraction *= 10;
+    }
+
+    const Price result = units * PRICE_SCALE + fraction;
+    price = negative ? -result : result;
+
+    return PARSE_OK;
+}
+
+/**
+ * Same as above for the token
+ * @param token what to parse
+ * @param price where to store the result
+ * @return parsing status
+ */
+inline ParseStatus ParsePrice(string_view token, Price &price)
+{
+    return ParsePrice(token.data(), token.data() + token.size(), price);
+}
+
+} // namespace tokenizers
+} // namespace md
+
+#endif /* numeric_parser_hpp */
@@ -9,7 +9,6 @@
 #include "order_add_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -19,10 +18,10 @@ using namespace md::tokenizers;
 
 OrderAddData::OrderAddData() :
     order_id_(0),
-    symbol_(""),
+    symbol_(),
     side_(OrderSide::UNKNOWN),
     quantity_(0),
-    price_(0.0)
+    price_(0)
 {
 }
 
@@ -48,66 +47,67 @@ OrderAddData & OrderAddData::operator=(const OrderAddData &obj)
     return *this;
 }
 
-void OrderAddData::processTokens(const vector<string> &tokens)
+void OrderAddData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != OrderAddIndex::SIZE)
     {
-        if (tokens.size() != OrderAddIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != "ORDER ADD")
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        order_id_ = stoull(tokens.at(OrderAddIndex::ORDER_ID));
-
-        symbol_ = tokens.at(OrderAddIndex::SYMBOL);
-
-        const auto & raw_side = tokens.at(OrderAddIndex::SIDE);
-
-        if (raw_side == "Buy")
-        {
-            side_ = OrderSide::BUY;
-        }
-        else if (raw_side == "Sell")
-        {
-            side_ = OrderSide::SELL;
-        }
-        else
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad side");
-            return;
-        }
-
-        quantity_ = stoull(tokens.at(OrderAddIndex::QUANTITY));
-        price_ = stod(tokens.at(OrderAddIndex::PRICE));
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != "ORDER ADD")
+    {
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
+    }
+
+    ParseStatus status = ParseUnsigned(tokens[OrderAddIndex::ORDER_ID], order_id_);
+
+    if (status != PARSE_OK)
+    {
+        Parent::setNumericFailure("OrderAddData::processTokens()", status);
+        return;
+    }
+
+    symbol_ = tokens[OrderAddIndex::SYMBOL];
+
+    const auto raw_side = tokens[OrderAddIndex::SIDE];
+
+    if (raw_side == "Buy")
+    {
+        side_ = OrderSide::BUY;
+    }
+    else if (raw_side == "Sell")
     {
-        cerr << "OrderAddData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        side_ = OrderSide::SELL;
     }
-    catch (invalid_argument &e)
+    else
     {
-        cerr << "OrderAddData::processTokens(): Numeric conversion failure: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad side");
+        return;
+    }
+
+    status = ParseUnsigned(tokens[OrderAddIndex::QUANTITY], quantity_);
+
+    if (status != PARSE_OK)
+    {
+        Parent::setNumericFailure("OrderAddData::processTokens()", status);
+        return;
+    }
+
+    status = ParsePrice(tokens[OrderAddIndex::PRICE], price_);
+
+    if (status != PARSE_OK)
+    {
+        Parent::setNumericFailure("OrderAddData::processTokens()", status);
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
 uint64_t OrderAddData::getOrderId()
@@ -115,7 +115,7 @@ uint64_t OrderAddData::getOrderId()
     return order_id_;
 }
 
-const string & OrderAddData::getSymbol()
+string_view OrderAddData::getSymbol()
 {
     return symbol_;
 }
@@ -131,6 +131,11 @@ uint64_t OrderAddData::getQuantity()
 }
 
 double OrderAddData::getPrice()
+{
+    return PriceToDouble(price_);
+}
+
+Price OrderAddData::getPriceTicks()
 {
     return price_;
 }
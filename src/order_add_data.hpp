@@ -10,9 +10,11 @@
 #define order_add_data_hpp
 
 //System includes
+#include <string_view>
 
 //Local includes
 #include "md_command_data.hpp"
+#include "price.hpp"
 #include "container_definitions.hpp"
 
 namespace md
@@ -57,15 +59,15 @@ public:
 
     /**
      * Implements the operation to process all of the tokens for Order Add command
-     * @param tokens vector of the tokens for OA command
+     * @param tokens list of the tokens for OA command
      */
-    virtual void processTokens(const vector<string> &tokens) override;
+    virtual void processTokens(const TokenList &tokens) override;
 
     /** Returns current order id */
     uint64_t getOrderId();
 
     /** Returns current symbol */
-    const string & getSymbol();
+    string_view getSymbol();
 
     /** Returns current order side */
     OrderSide getSide();
@@ -76,13 +78,16 @@ public:
     /** Returns current stock price */
     double getPrice();
 
+    /** Returns current stock price in the fixed point ticks */
+    Price getPriceTicks();
+
 protected:
 
     /** Holds order id. No constraints */
     uint64_t order_id_;
 
-    /** Holds stock symbol. Can't be empty string */
-    string symbol_;
+    /** Holds stock symbol. Can't be empty string. Points in to the tokenized line */
+    string_view symbol_;
 
     /** Holds side of the operation. Either buy or sell. Converted from the string */
     OrderSide side_;
@@ -90,8 +95,8 @@ protected:
     /** Holds the quantity of the deal */
     uint64_t quantity_;
 
-    /** Holds the price for one stock */
-    double price_;
+    /** Holds the price for one stock. Fixed point, exactly as it was in the feed */
+    Price price_;
 
 private:
 };
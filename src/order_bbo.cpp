@@ -27,7 +27,7 @@ ostream & operator<<(ostream & out, const OrderBbo & obj)
     {
         out << '|' << setw(default_width) << obj.buy_order_count_
             << '|' << setw(default_width) << obj.buy_total_volume_
-            << '|' << setw(default_width) << fixed << setprecision(default_precision) << obj.buy_share_price_;
+            << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(obj.buy_share_price_);
     }
     else
     {
@@ -38,7 +38,7 @@ ostream & operator<<(ostream & out, const OrderBbo & obj)
 
     if(!obj.nil_sell_)
     {
-        out << '|' << setw(default_width) << fixed << setprecision(default_precision) << obj.sell_share_price_
+        out << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(obj.sell_share_price_)
             << '|' << setw(default_width) << obj.sell_total_volume_
             << '|' << setw(default_width) << obj.sell_order_count_
             << '|';
@@ -58,10 +58,10 @@ ostream & operator<<(ostream & out, const OrderBbo & obj)
 
 OrderBbo::OrderBbo() :
     buy_total_volume_(0),
-    buy_share_price_(0.0),
+    buy_share_price_(0),
     buy_order_count_(0),
     sell_total_volume_(0),
-    sell_share_price_(0.0),
+    sell_share_price_(0),
     sell_order_count_(0),
     nil_buy_(true),
     nil_sell_(true)
@@ -69,10 +69,10 @@ OrderBbo::OrderBbo() :
 }
 
 OrderBbo::OrderBbo(uint64_t buy_total_volume,
-                   double buy_share_price,
+                   Price buy_share_price,
                    uint32_t buy_order_count,
                    uint64_t sell_total_volume,
-                   double sell_share_price,
+                   Price sell_share_price,
                    uint32_t sell_order_count) :
     buy_total_volume_(buy_total_volume),
     buy_share_price_(buy_share_price),
@@ -100,7 +100,7 @@ void OrderBbo::setBuyTotalVolume(uint64_t volume)
     buy_total_volume_ = volume;
 }
 
-void OrderBbo::setBuySharePrice(double price)
+void OrderBbo::setBuySharePrice(Price price)
 {
     buy_share_price_ = price;
 }
@@ -115,7 +115,7 @@ void OrderBbo::setSellTotalVolume(uint64_t volume)
     sell_total_volume_ = volume;
 }
 
-void OrderBbo::setSellSharePrice(double price)
+void OrderBbo::setSellSharePrice(Price price)
 {
     sell_share_price_ = price;
 }
@@ -130,7 +130,7 @@ uint64_t OrderBbo::getBuyTotalVolume()
     return buy_total_volume_;
 }
 
-double OrderBbo::getBuySharePrice()
+Price OrderBbo::getBuySharePrice()
 {
     return buy_share_price_;
 }
@@ -145,7 +145,7 @@ uint64_t OrderBbo::getSellTotalVolume()
     return sell_total_volume_;
 }
 
-double OrderBbo::getSellSharePrice()
+Price OrderBbo::getSellSharePrice()
 {
     return sell_share_price_;
 }
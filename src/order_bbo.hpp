@@ -14,6 +14,7 @@
 #include <tuple>
 
 //Local includes
+#include "price.hpp"
 
 using namespace std;
 
@@ -41,17 +42,17 @@ public:
     /**
      * Constructor
      * @param buy_total_volume cumulative volume for buy orders
-     * @param buy_share_price buy share price level
+     * @param buy_share_price buy share price level in ticks
      * @param buy_order_count number of same price level buy orders
      * @param sell_total_volume cumulative volume for sell orders
-     * @param sell_share_price sell share price level
+     * @param sell_share_price sell share price level in ticks
      * @param sell_order_count number of same price level sell orders
      */
     OrderBbo(uint64_t buy_total_volume,
-             double buy_share_price,
+             Price buy_share_price,
              uint32_t buy_order_count,
              uint64_t sell_total_volume,
-             double sell_share_price,
+             Price sell_share_price,
              uint32_t sell_order_count);
 
     /** Default destructor */
@@ -71,9 +72,9 @@ public:
 
     /**
      * Sets the price for one buy share
-     * @param price for one share
+     * @param price for one share in ticks
      */
-    void setBuySharePrice(double price);
+    void setBuySharePrice(Price price);
 
     /**
      * Sets the buy order count with the same price level
@@ -89,9 +90,9 @@ public:
 
     /**
      * Sets the price for one sell share
-     * @param price for one share
+     * @param price for one share in ticks
      */
-    void setSellSharePrice(double price);
+    void setSellSharePrice(Price price);
 
     /**
      * Sets the sell order count with the same price level
@@ -107,9 +108,9 @@ public:
 
     /**
      * Returns the price for one buy share
-     * @return price for one share
+     * @return price for one share in ticks
      */
-    double getBuySharePrice();
+    Price getBuySharePrice();
 
     /**
      * Returns the buy order count with the same price level
@@ -125,9 +126,9 @@ public:
 
     /**
      * Returns the price for one sell share
-     * @return price for one share
+     * @return price for one share in ticks
      */
-    double getSellSharePrice();
+    Price getSellSharePrice();
 
     /**
      * Returns the sell order count with the same price level
@@ -162,8 +163,8 @@ protected:
     /** Cumulative volume for buy orders */
     uint64_t buy_total_volume_;
 
-    /** Buy share price level */
-    double buy_share_price_;
+    /** Buy share price level in ticks */
+    Price buy_share_price_;
 
     /** Number of same price level buy orders */
     uint32_t buy_order_count_;
@@ -171,8 +172,8 @@ protected:
     /** Cumulative volume for sell orders */
     uint64_t sell_total_volume_;
 
-    /** Sell share price level */
-    double sell_share_price_;
+    /** Sell share price level in ticks */
+    Price sell_share_price_;
 
     /** Number of same price level sell orders */
     uint32_t sell_order_count_;
@@ -9,7 +9,6 @@
 #include "order_cancel_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -36,44 +35,32 @@ OrderCancelData & OrderCancelData::operator=(const OrderCancelData &obj)
     return *this;
 }
 
-void OrderCancelData::processTokens(const vector<string> &tokens)
+void OrderCancelData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != OrderCancelIndex::SIZE)
     {
-        if (tokens.size() != OrderCancelIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != "ORDER CANCEL")
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        order_id_ = stoull(tokens.at(OrderCancelIndex::ORDER_ID));
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != "ORDER CANCEL")
     {
-        cerr << "OrderCancelData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
     }
-    catch (invalid_argument &e)
+
+    ParseStatus status = ParseUnsigned(tokens[OrderCancelIndex::ORDER_ID], order_id_);
+
+    if (status != PARSE_OK)
     {
-        cerr << "OrderCancelData::processTokens(): Numeric conversion failure: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setNumericFailure("OrderCancelData::processTokens()", status);
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
 uint64_t OrderCancelData::getOrderId()
@@ -52,9 +52,9 @@ public:
 
     /**
      * Implements the operation to process all of the tokens for Order Cancel command
-     * @param tokens vector of the tokens for OC command
+     * @param tokens list of the tokens for OC command
      */
-    virtual void processTokens(const vector<string> &tokens) override;
+    virtual void processTokens(const TokenList &tokens) override;
 
     /** Returns current order id */
     uint64_t getOrderId();
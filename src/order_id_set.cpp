@@ -0,0 +1,138 @@
+//
+//  order_id_set.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 11.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "order_id_set.hpp"
+
+//System includes
+
+//Local includes
+
+using namespace std;
+using namespace md::processors;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Number of the 64 bit words in one page */
+const size_t PAGE_WORDS = OrderIdSet::PAGE_BITS / 64;
+
+/**
+ * Is used to get the bit of the id in its word
+ * @param id order id
+ * @return mask with the single bit set
+ */
+inline uint64_t BitMask(uint64_t id)
+{
+    return uint64_t(1) << (id % 64);
+}
+
+/**
+ * Is used to get the index of the id word in its page
+ * @param id order id
+ * @return word index
+ */
+inline size_t WordIndex(uint64_t id)
+{
+    return static_cast<size_t>((id % OrderIdSet::PAGE_BITS) / 64);
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+OrderIdSet::OrderIdSet() :
+    last_index_(0),
+    last_page_(nullptr),
+    size_(0)
+{
+}
+
+uint64_t * OrderIdSet::findPage(uint64_t id) const
+{
+    const uint64_t index = id / PAGE_BITS;
+
+    if (last_page_ != nullptr && last_index_ == index)
+    {
+        return last_page_;
+    }
+
+    auto search = pages_.find(index);
+
+    if (search == pages_.end())
+    {
+        return nullptr;
+    }
+
+    last_index_ = index;
+    last_page_ = search->second.get();
+
+    return last_page_;
+}
+
+void OrderIdSet::insert(uint64_t id)
+{
+    uint64_t *page = findPage(id);
+
+    if (page == nullptr)
+    {
+        const uint64_t index = id / PAGE_BITS;
+
+        //Value initialized, so all the bits are clear
+        auto &added = pages_[index];
+        added.reset(new uint64_t[PAGE_WORDS]());
+
+        last_index_ = index;
+        last_page_ = page = added.get();
+    }
+
+    uint64_t &word = page[WordIndex(id)];
+
+    if ((word & BitMask(id)) == 0)
+    {
+        word |= BitMask(id);
+        ++size_;
+    }
+}
+
+void OrderIdSet::erase(uint64_t id)
+{
+    uint64_t *page = findPage(id);
+
+    if (page == nullptr)
+    {
+        return;
+    }
+
+    uint64_t &word = page[WordIndex(id)];
+
+    if ((word & BitMask(id)) != 0)
+    {
+        word &= ~BitMask(id);
+        --size_;
+    }
+}
+
+bool OrderIdSet::contains(uint64_t id) const
+{
+    const uint64_t *page = findPage(id);
+    return page != nullptr && (page[WordIndex(id)] & BitMask(id)) != 0;
+}
+
+size_t OrderIdSet::size() const
+{
+    return size_;
+}
+
+void OrderIdSet::clear()
+{
+    pages_.clear();
+    last_page_ = nullptr;
+    size_ = 0;
+}
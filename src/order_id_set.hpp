@@ -0,0 +1,102 @@
+//
+//  order_id_set.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 11.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef order_id_set_hpp
+#define order_id_set_hpp
+
+//System includes
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+
+//Local includes
+#include "defines.h"
+
+namespace md
+{
+namespace processors
+{
+
+using namespace std;
+
+/**
+ * Compact set of the order ids. Ids are mostly dense and growing, so they are
+ * kept as the bitmap split in to the pages which are allocated on demand.
+ * One bit per id, 8 KB per 65536 consecutive ids.
+ */
+class OrderIdSet
+{
+public:
+    /** Number of the ids covered by one page */
+    static constexpr uint64_t PAGE_BITS = 1 << 16;
+
+    /** Default constructor */
+    OrderIdSet();
+
+    /** Default destructor */
+    ~OrderIdSet() = default;
+
+    /**
+     * Is used to add the id to the set
+     * @param id to add
+     */
+    void insert(uint64_t id);
+
+    /**
+     * Is used to remove the id from the set
+     * @param id to remove
+     */
+    void erase(uint64_t id);
+
+    /**
+     * Is used to check whether or not the id is in the set
+     * @param id to check
+     * @return true if present
+     */
+    bool contains(uint64_t id) const;
+
+    /**
+     * Is used to get the number of the ids in the set
+     * @return number of the ids
+     */
+    size_t size() const;
+
+    /** Removes all the ids */
+    void clear();
+
+private:
+    /** Words of one page */
+    using Page = unique_ptr<uint64_t[]>;
+
+    /**
+     * Is used to find the page of the id
+     * @param id to look up
+     * @return page words. Null if the page was not allocated yet
+     */
+    uint64_t * findPage(uint64_t id) const;
+
+    /** Allocated pages by their index */
+    unordered_map<uint64_t, Page> pages_;
+
+    /** Index of the last used page. Ids usually come in runs */
+    mutable uint64_t last_index_;
+
+    /** Words of the last used page */
+    mutable uint64_t *last_page_;
+
+    /** Number of the ids in the set */
+    size_t size_;
+
+    PREVENT_COPY(OrderIdSet);
+};
+
+} // namespace processors
+} // namespace md
+
+#endif /* order_id_set_hpp */
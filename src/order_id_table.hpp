@@ -0,0 +1,604 @@
+//
+//  order_id_table.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 13.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef order_id_table_hpp
+#define order_id_table_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+
+using namespace std;
+
+/**
+ * Map of the order ids to the values. Ids are kept in the open addressing
+ * table with robin hood probing. Erase shifts the following entries back,
+ * so there are no tombstones and the probe sequences stay short.
+ *
+ * Most venues hand out nearly sequential ids. Once the inserted ids turn out
+ * to be dense enough, the table switches to the paged array indexed by the id
+ * directly. Ids which do not fit the pages (far below or far above the
+ * current range) still go to the hash part.
+ *
+ * Pointers to the values are valid until the next insert or erase.
+ * Value has to be default constructible.
+ */
+template <typename Value>
+class OrderIdTable
+{
+public:
+    /** Number of the ids covered by one page of the dense part */
+    static constexpr uint64_t PAGE_SIZE = 512;
+
+    /** Number of the inserts after which the density is checked */
+    static constexpr size_t DENSE_MIN_INSERTS = 4096;
+
+    /** Ids are dense if their span is at most this many times the number of the inserts */
+    static constexpr uint64_t DENSE_SPAN_FACTOR = 4;
+
+    /** How many pages beyond the last one the dense part may grow by at once */
+    static constexpr uint64_t PAGE_SLACK = 64;
+
+    /** Default constructor */
+    OrderIdTable();
+
+    /** Default destructor */
+    ~OrderIdTable() = default;
+
+    /**
+     * Is used to find the value of the id
+     * @param id to look up
+     * @return value. Null if there is no such id
+     */
+    Value * find(uint64_t id);
+
+    /**
+     * Same as above, but read only
+     * @param id to look up
+     * @return value. Null if there is no such id
+     */
+    const Value * find(uint64_t id) const;
+
+    /**
+     * Is used to add the id with the default constructed value
+     * @param id to add
+     * @return value of the id and true if it was added. The existing
+     *         value and false if the id was present already
+     */
+    pair<Value *, bool> tryEmplace(uint64_t id);
+
+    /**
+     * Is used to remove the id
+     * @param id to remove
+     * @return true if the id was present
+     */
+    bool erase(uint64_t id);
+
+    /**
+     * Is used to check whether or not the id is present
+     * @param id to check
+     * @return true if present
+     */
+    bool contains(uint64_t id) const;
+
+    /**
+     * Is used to get the number of the ids
+     * @return number of the ids
+     */
+    size_t size() const;
+
+    /**
+     * Is used to check whether or not the dense part is in use
+     * @return true if the ids are indexed directly
+     */
+    bool isDense() const;
+
+    /**
+     * Is used to start loading the place where the id would be found
+     * @param id which is going to be looked up soon
+     */
+    void prefetch(uint64_t id) const;
+
+    /** Removes all the ids and goes back to the hash part only */
+    void clear();
+
+private:
+    /** Entry of the hash part */
+    struct Slot
+    {
+        /** Order id */
+        uint64_t id;
+
+        /** Distance from the home slot plus one. Zero if the slot is empty */
+        uint32_t distance;
+
+        /** Value of the id */
+        Value value;
+    };
+
+    /** Page of the dense part */
+    struct Page
+    {
+        /** Bit is set if the id is present */
+        uint64_t present[PAGE_SIZE / 64];
+
+        /** Values by id offset in the page */
+        Value values[PAGE_SIZE];
+
+        /** Number of the present ids */
+        size_t count;
+    };
+
+    /** Index which is returned when the id is not in the hash part */
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    /**
+     * Is used to get the home slot of the id. Fibonacci hashing spreads
+     * the sequential ids over the whole table
+     * @param id order id
+     * @return slot index
+     */
+    size_t home(uint64_t id) const;
+
+    /**
+     * Is used to find the slot of the id in the hash part
+     * @param id to look up
+     * @return slot index. NOT_FOUND if absent
+     */
+    size_t findSlot(uint64_t id) const;
+
+    /**
+     * Is used to add the id which is known to be absent to the hash part
+     * @param id to add
+     * @param value of the id
+     * @return slot index of the id
+     */
+    size_t insertSlot(uint64_t id, Value &&value);
+
+    /**
+     * Is used to remove the slot and shift the following entries back
+     * @param index of the slot
+     */
+    void eraseSlot(size_t index);
+
+    /**
+     * Is used to resize the hash part
+     * @param capacity new number of the slots. Power of two
+     */
+    void rehash(size_t capacity);
+
+    /**
+     * Is used to get the page of the id
+     * @param id to look up
+     * @return page. Null if the id is not covered by the allocated pages
+     */
+    Page * findPage(uint64_t id) const;
+
+    /**
+     * Is used to check whether or not the id belongs to the dense part
+     * @param id to check
+     * @return true if the page of the id may be allocated
+     */
+    bool fitsPages(uint64_t id) const;
+
+    /**
+     * Is used to put the id in to the dense part
+     * @param id which fits the pages and is absent
+     * @param value of the id
+     * @return value of the id
+     */
+    Value * insertPaged(uint64_t id, Value &&value);
+
+    /** Moves the hash part in to the pages if the ids were dense so far */
+    void checkDensity();
+
+    /** Slots of the hash part. Power of two */
+    vector<Slot> slots_;
+
+    /** Number of the ids in the hash part */
+    size_t hashed_;
+
+    /** Number of the ids in the dense part */
+    size_t paged_;
+
+    /** 64 minus log2 of the number of the slots */
+    unsigned shift_;
+
+    /** Pages of the dense part. Index is the page of the id minus base_page_ */
+    vector<unique_ptr<Page>> pages_;
+
+    /** Page of the smallest id the dense part covers */
+    uint64_t base_page_;
+
+    /** Is set once the dense part is in use */
+    bool dense_;
+
+    /** Number of the inserts into the hash part. Is used to detect the dense ids */
+    size_t inserts_;
+
+    /** Smallest id inserted into the hash part */
+    uint64_t min_id_;
+
+    /** Largest id inserted into the hash part */
+    uint64_t max_id_;
+
+    PREVENT_COPY(OrderIdTable);
+};
+
+/**************************** Implementation **************************/
+
+template <typename Value>
+OrderIdTable<Value>::OrderIdTable() :
+    hashed_(0),
+    paged_(0),
+    shift_(64),
+    base_page_(0),
+    dense_(false),
+    inserts_(0),
+    min_id_(UINT64_MAX),
+    max_id_(0)
+{
+}
+
+template <typename Value>
+size_t OrderIdTable<Value>::home(uint64_t id) const
+{
+    return static_cast<size_t>((id * 0x9E3779B97F4A7C15ull) >> shift_);
+}
+
+template <typename Value>
+size_t OrderIdTable<Value>::findSlot(uint64_t id) const
+{
+    if (hashed_ == 0)
+    {
+        return NOT_FOUND;
+    }
+
+    const size_t mask = slots_.size() - 1;
+
+    for (size_t index = home(id), distance = 1;; index = (index + 1) & mask, ++distance)
+    {
+        const Slot &slot = slots_[index];
+
+        //Empty slot or the entry which is closer to home than the id would be
+        if (slot.distance < distance)
+        {
+            return NOT_FOUND;
+        }
+
+        if (slot.id == id)
+        {
+            return index;
+        }
+    }
+}
+
+template <typename Value>
+size_t OrderIdTable<Value>::insertSlot(uint64_t id, Value &&value)
+{
+    //Load factor is kept at or below 7/8
+    if ((hashed_ + 1) * 8 > slots_.size() * 7)
+    {
+        rehash(slots_.empty() ? 16 : slots_.size() * 2);
+    }
+
+    const size_t mask = slots_.size() - 1;
+
+    Slot carried{id, 1, move(value)};
+    size_t placed = NOT_FOUND;
+
+    for (size_t index = home(id);; index = (index + 1) & mask, ++carried.distance)
+    {
+        Slot &slot = slots_[index];
+
+        if (slot.distance == 0)
+        {
+            slot = move(carried);
+            ++hashed_;
+
+            return placed == NOT_FOUND ? index : placed;
+        }
+
+        //Robin hood: the entry which is closer to home gives the slot away
+        if (slot.distance < carried.distance)
+        {
+            swap(slot, carried);
+
+            if (placed == NOT_FOUND)
+            {
+                placed = index;
+            }
+        }
+    }
+}
+
+template <typename Value>
+void OrderIdTable<Value>::eraseSlot(size_t index)
+{
+    const size_t mask = slots_.size() - 1;
+
+    for (size_t next = (index + 1) & mask; slots_[next].distance > 1; index = next, next = (next + 1) & mask)
+    {
+        slots_[index] = move(slots_[next]);
+        --slots_[index].distance;
+    }
+
+    slots_[index].distance = 0;
+    --hashed_;
+}
+
+template <typename Value>
+void OrderIdTable<Value>::rehash(size_t capacity)
+{
+    vector<Slot> old(capacity);
+    old.swap(slots_);
+
+    hashed_ = 0;
+    shift_ = 64;
+
+    for (size_t size = capacity; size > 1; size >>= 1)
+    {
+        --shift_;
+    }
+
+    for (auto &slot : old)
+    {
+        if (slot.distance != 0)
+        {
+            insertSlot(slot.id, move(slot.value));
+        }
+    }
+}
+
+template <typename Value>
+typename OrderIdTable<Value>::Page * OrderIdTable<Value>::findPage(uint64_t id) const
+{
+    const uint64_t page = id / PAGE_SIZE;
+
+    if (!dense_ || page < base_page_ || page - base_page_ >= pages_.size())
+    {
+        return nullptr;
+    }
+
+    return pages_[page - base_page_].get();
+}
+
+template <typename Value>
+bool OrderIdTable<Value>::fitsPages(uint64_t id) const
+{
+    const uint64_t page = id / PAGE_SIZE;
+    return dense_ && page >= base_page_ && page - base_page_ < pages_.size() + PAGE_SLACK;
+}
+
+template <typename Value>
+Value * OrderIdTable<Value>::insertPaged(uint64_t id, Value &&value)
+{
+    const uint64_t index = id / PAGE_SIZE - base_page_;
+
+    if (index >= pages_.size())
+    {
+        pages_.resize(index + 1);
+    }
+
+    auto &page = pages_[index];
+
+    if (!page)
+    {
+        //Value initialized, so no id is present
+        page.reset(new Page());
+    }
+
+    const uint64_t offset = id % PAGE_SIZE;
+
+    page->present[offset / 64] |= uint64_t(1) << (offset % 64);
+    page->values[offset] = move(value);
+    ++page->count;
+    ++paged_;
+
+    return &page->values[offset];
+}
+
+template <typename Value>
+void OrderIdTable<Value>::checkDensity()
+{
+    if (dense_ || inserts_ < DENSE_MIN_INSERTS || (max_id_ - min_id_) / DENSE_SPAN_FACTOR > inserts_)
+    {
+        return;
+    }
+
+    //Pages start from the oldest live id
+    uint64_t min_live = UINT64_MAX;
+
+    for (const auto &slot : slots_)
+    {
+        if (slot.distance != 0 && slot.id < min_live)
+        {
+            min_live = slot.id;
+        }
+    }
+
+    dense_ = true;
+    base_page_ = min_live / PAGE_SIZE;
+
+    vector<Slot> old;
+    old.swap(slots_);
+
+    hashed_ = 0;
+    shift_ = 64;
+
+    for (auto &slot : old)
+    {
+        if (slot.distance == 0)
+        {
+            continue;
+        }
+
+        if (fitsPages(slot.id))
+        {
+            insertPaged(slot.id, move(slot.value));
+        }
+        else
+        {
+            insertSlot(slot.id, move(slot.value));
+        }
+    }
+}
+
+template <typename Value>
+Value * OrderIdTable<Value>::find(uint64_t id)
+{
+    return const_cast<Value *>(static_cast<const OrderIdTable *>(this)->find(id));
+}
+
+template <typename Value>
+const Value * OrderIdTable<Value>::find(uint64_t id) const
+{
+    const Page *page = findPage(id);
+
+    if (page != nullptr)
+    {
+        const uint64_t offset = id % PAGE_SIZE;
+
+        if ((page->present[offset / 64] & (uint64_t(1) << (offset % 64))) != 0)
+        {
+            return &page->values[offset];
+        }
+    }
+
+    const size_t index = findSlot(id);
+    return index == NOT_FOUND ? nullptr : &slots_[index].value;
+}
+
+template <typename Value>
+pair<Value *, bool> OrderIdTable<Value>::tryEmplace(uint64_t id)
+{
+    Value *existing = find(id);
+
+    if (existing != nullptr)
+    {
+        return {existing, false};
+    }
+
+    if (fitsPages(id))
+    {
+        return {insertPaged(id, Value()), true};
+    }
+
+    ++inserts_;
+    min_id_ = min(min_id_, id);
+    max_id_ = max(max_id_, id);
+
+    const size_t index = insertSlot(id, Value());
+
+    if (!dense_ && inserts_ >= DENSE_MIN_INSERTS)
+    {
+        checkDensity();
+
+        if (dense_)
+        {
+            return {find(id), true};
+        }
+    }
+
+    return {&slots_[index].value, true};
+}
+
+template <typename Value>
+bool OrderIdTable<Value>::erase(uint64_t id)
+{
+    const uint64_t page_index = id / PAGE_SIZE - base_page_;
+    Page *page = findPage(id);
+
+    if (page != nullptr)
+    {
+        const uint64_t offset = id % PAGE_SIZE;
+        uint64_t &word = page->present[offset / 64];
+
+        if ((word & (uint64_t(1) << (offset % 64))) != 0)
+        {
+            word &= ~(uint64_t(1) << (offset % 64));
+            --paged_;
+
+            if (--page->count == 0)
+            {
+                //Ids move forward, the page is not likely to be used again
+                pages_[page_index].reset();
+            }
+
+            return true;
+        }
+    }
+
+    const size_t index = findSlot(id);
+
+    if (index == NOT_FOUND)
+    {
+        return false;
+    }
+
+    eraseSlot(index);
+    return true;
+}
+
+template <typename Value>
+bool OrderIdTable<Value>::contains(uint64_t id) const
+{
+    return find(id) != nullptr;
+}
+
+template <typename Value>
+size_t OrderIdTable<Value>::size() const
+{
+    return hashed_ + paged_;
+}
+
+template <typename Value>
+bool OrderIdTable<Value>::isDense() const
+{
+    return dense_;
+}
+
+template <typename Value>
+void OrderIdTable<Value>::prefetch(uint64_t id) const
+{
+    const Page *page = findPage(id);
+
+    if (page != nullptr)
+    {
+        __builtin_prefetch(&page->values[id % PAGE_SIZE]);
+    }
+    else if (hashed_ != 0)
+    {
+        __builtin_prefetch(&slots_[home(id)]);
+    }
+}
+
+template <typename Value>
+void OrderIdTable<Value>::clear()
+{
+    slots_.clear();
+    pages_.clear();
+
+    hashed_ = 0;
+    paged_ = 0;
+    shift_ = 64;
+    base_page_ = 0;
+    dense_ = false;
+    inserts_ = 0;
+    min_id_ = UINT64_MAX;
+    max_id_ = 0;
+}
+
+#endif /* order_id_table_hpp */
@@ -16,17 +16,57 @@
 
 /*************************** Helper Functions *************************/
 
+namespace
+{
+
+/**
+ * Is used to get the first order of the side
+ * @param book side of the book
+ * @param level where to store the level of the order
+ * @return first order. NO_ORDER if the side is empty
+ */
+template <typename Book>
+OrderRef FirstOrder(const Book &book, typename Book::const_iterator &level)
+{
+    level = book.begin();
+    return level != book.end() ? level->head : NO_ORDER;
+}
+
+/**
+ * Is used to get the order which follows the given one
+ * @param book side of the book
+ * @param level level of the order. Is moved to the next level if needed
+ * @param order current order
+ * @return next order. NO_ORDER if there are no more orders on this side
+ */
+template <typename Book>
+OrderRef NextOrder(const Book &book, typename Book::const_iterator &level, OrderRef order)
+{
+    const OrderRef next = book.orders().node(order).next;
+
+    if (next != NO_ORDER)
+    {
+        return next;
+    }
+
+    ++level;
+    return level != book.end() ? level->head : NO_ORDER;
+}
+
+} // namespace
+
 /*************************** OrderIterator ****************************/
 
-OrderIterator::OrderIterator(OrderSetGreaterPtr bid, OrderSetLessPtr ask) :
-    bid_(bid), ask_(ask), current_bid_(bid->begin()), current_ask_(ask->begin())
+OrderIterator::OrderIterator(const BidBook &bid, const AskBook &ask) :
+    bid_(&bid), ask_(&ask)
 {
+    first();
 }
 
 void OrderIterator::first()
 {
-    current_bid_ = bid_->begin();
-    current_ask_ = ask_->begin();
+    current_bid_ = FirstOrder(*bid_, bid_level_);
+    current_ask_ = FirstOrder(*ask_, ask_level_);
 }
 
 void OrderIterator::next()
@@ -35,12 +75,12 @@ void OrderIterator::next()
 
     if(status != DoneStatus::BID_DONE && status != DoneStatus::ALL_DONE)
     {
-        ++current_bid_;
+        current_bid_ = NextOrder(*bid_, bid_level_, current_bid_);
     }
 
     if(status != DoneStatus::ASK_DONE && status != DoneStatus::ALL_DONE)
     {
-        ++current_ask_;
+        current_ask_ = NextOrder(*ask_, ask_level_, current_ask_);
     }
 }
 
@@ -48,15 +88,15 @@ OrderIterator::DoneStatus OrderIterator::done()
 {
     DoneStatus status;
 
-    if(current_bid_ == bid_->end() && current_ask_ == ask_->end())
+    if(current_bid_ == NO_ORDER && current_ask_ == NO_ORDER)
     {
         status = DoneStatus::ALL_DONE;
     }
-    else if(current_bid_ == bid_->end() && current_ask_ != ask_->end())
+    else if(current_bid_ == NO_ORDER && current_ask_ != NO_ORDER)
     {
         status = DoneStatus::BID_DONE;
     }
-    else if(current_bid_ != bid_->end() && current_ask_ == ask_->end())
+    else if(current_bid_ != NO_ORDER && current_ask_ == NO_ORDER)
     {
         status = DoneStatus::ASK_DONE;
     }
@@ -68,14 +108,12 @@ OrderIterator::DoneStatus OrderIterator::done()
     return status;
 }
 
-const OrderRequest & OrderIterator::getBid()
+OrderRequest OrderIterator::getBid()
 {
-    return *(current_bid_);
+    return bid_->orders().request(current_bid_);
 }
 
-const OrderRequest & OrderIterator::getAsk()
+OrderRequest OrderIterator::getAsk()
 {
-    return *(current_ask_);
+    return ask_->orders().request(current_ask_);
 }
-
-
@@ -10,26 +10,21 @@
 #define _ORDERITERATOR_H
 
 //System includes
-#include <set>
 
 //Local includes
 #include "container_definitions.hpp"
-
-//Forward declarations
-struct OrderRequest;
+#include "price_ladder_book.hpp"
 
 using namespace std;
 
 /**
- * Iterator for the Order list. Is used to traverse the list. Can be
- * invalidated depending on the operations happened with the list object
+ * Iterator for the Order list. Is used to traverse the list from the best
+ * price, orders of one price in the arrival order. Can be invalidated
+ * depending on the operations happened with the list object
  */
 class OrderIterator
 {
 public:
-    /** Multiset iterator definition for the convinience */
-    using OrderSetIterator = multiset<OrderRequest>::iterator;
-
     enum DoneStatus
     {
         NOT_DONE,
@@ -40,10 +35,10 @@ public:
 
     /**
      * Constructor
-     * @param bid pointer to the "Buy" order table
-     * @param ask pointer to the "Sell" order table
+     * @param bid "Buy" side of the book. Has to outlive the iterator
+     * @param ask "Sell" side of the book. Has to outlive the iterator
      */
-    OrderIterator(OrderSetGreaterPtr bid, OrderSetLessPtr ask);
+    OrderIterator(const BidBook &bid, const AskBook &ask);
 
     /** Default destructor */
     ~OrderIterator() = default;
@@ -64,26 +59,32 @@ public:
      * Get the current bid order for this iterator
      * @return current bid
      */
-    const OrderRequest & getBid();
+    OrderRequest getBid();
 
     /**
      * Get the current ask order for this iterator
      * @return current ask
      */
-    const OrderRequest & getAsk();
+    OrderRequest getAsk();
 
 private:
-    /** Holds the pointer to the current "Buy" order table */
-    OrderSetGreaterPtr bid_;
+    /** Holds the pointer to the "Buy" side */
+    const BidBook *bid_;
+
+    /** Holds the pointer to the "Sell" side */
+    const AskBook *ask_;
+
+    /** Holds the current "Buy" price level */
+    BidBook::const_iterator bid_level_;
 
-    /** Holds the pointer to the current "Sell" order table */
-    OrderSetLessPtr ask_;
+    /** Holds the current "Sell" price level */
+    AskBook::const_iterator ask_level_;
 
-    /** Holds the multiset iterator to the current "Buy" order table */
-    OrderSetIterator current_bid_;
+    /** Holds the current "Buy" order. NO_ORDER once the side is done */
+    OrderRef current_bid_;
 
-    /** Holds the multiset iterator to the current "Sell" order table */
-    OrderSetIterator current_ask_;
+    /** Holds the current "Sell" order. NO_ORDER once the side is done */
+    OrderRef current_ask_;
 
     /** Deleted default constructor */
     OrderIterator() = delete;
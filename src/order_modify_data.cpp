@@ -9,7 +9,6 @@
 #include "order_modify_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -20,7 +19,7 @@ using namespace md::tokenizers;
 OrderModifyData::OrderModifyData() :
     order_id_(0),
     quantity_(0),
-    price_(0.0)
+    price_(0)
 {
 }
 
@@ -42,46 +41,42 @@ OrderModifyData & OrderModifyData::operator=(const OrderModifyData &obj)
     return *this;
 }
 
-void OrderModifyData::processTokens(const vector<string> &tokens)
+void OrderModifyData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != OrderModifyIndex::SIZE)
     {
-        if (tokens.size() != OrderModifyIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != "ORDER MODIFY")
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        order_id_ = stoull(tokens.at(OrderModifyIndex::ORDER_ID));
-        quantity_ = stoull(tokens.at(OrderModifyIndex::QUANTITY));
-        price_ = stod(tokens.at(OrderModifyIndex::PRICE));
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != "ORDER MODIFY")
+    {
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
+    }
+
+    ParseStatus status = ParseUnsigned(tokens[OrderModifyIndex::ORDER_ID], order_id_);
+
+    if (status == PARSE_OK)
+    {
+        status = ParseUnsigned(tokens[OrderModifyIndex::QUANTITY], quantity_);
+    }
+
+    if (status == PARSE_OK)
     {
-        cerr << "OrderModifyData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        status = ParsePrice(tokens[OrderModifyIndex::PRICE], price_);
     }
-    catch (invalid_argument &e)
+
+    if (status != PARSE_OK)
     {
-        cerr << "OrderModifyData::processTokens(): Numeric conversion failure: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setNumericFailure("OrderModifyData::processTokens()", status);
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
 uint64_t OrderModifyData::getOrderId()
@@ -95,6 +90,11 @@ uint64_t OrderModifyData::getQuantity()
 }
 
 double OrderModifyData::getPrice()
+{
+    return PriceToDouble(price_);
+}
+
+Price OrderModifyData::getPriceTicks()
 {
     return price_;
 }
@@ -13,6 +13,7 @@
 
 //Local includes
 #include "md_command_data.hpp"
+#include "price.hpp"
 
 namespace md
 {
@@ -54,9 +55,9 @@ public:
 
     /**
      * Implements the operation to process all of the tokens for Order Modify command
-     * @param tokens vector of the tokens for OM command
+     * @param tokens list of the tokens for OM command
      */
-    virtual void processTokens(const vector<string> &tokens) override;
+    virtual void processTokens(const TokenList &tokens) override;
 
     /** Returns current order id */
     uint64_t getOrderId();
@@ -67,6 +68,9 @@ public:
     /** Returns current stock price */
     double getPrice();
 
+    /** Returns current stock price in the fixed point ticks */
+    Price getPriceTicks();
+
 protected:
 
     /** Holds order id. No constraints */
@@ -75,8 +79,8 @@ protected:
     /** Holds the quantity of the deal */
     uint64_t quantity_;
 
-    /** Holds the price for one stock */
-    double price_;
+    /** Holds the price for one stock. Fixed point, exactly as it was in the feed */
+    Price price_;
 
 private:
 };
@@ -0,0 +1,60 @@
+//
+//  order_pool.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 17.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "order_pool.hpp"
+
+//System includes
+#include <stdexcept>
+
+//Local includes
+
+/**************************** Implementation **************************/
+
+OrderRef OrderPool::allocate(uint64_t order_id, uint64_t quantity, Price price)
+{
+    OrderRef order = free_;
+
+    if (order != NO_ORDER)
+    {
+        free_ = nodes_[order].next;
+        nodes_[order] = {quantity, price, NO_ORDER, NO_ORDER};
+        order_ids_[order] = order_id;
+    }
+    else
+    {
+        if (nodes_.size() >= NO_ORDER)
+        {
+            throw length_error("OrderPool can't hold any more orders");
+        }
+
+        order = static_cast<OrderRef>(nodes_.size());
+        nodes_.push_back({quantity, price, NO_ORDER, NO_ORDER});
+        order_ids_.push_back(order_id);
+    }
+
+    ++size_;
+    return order;
+}
+
+void OrderPool::deallocate(OrderRef order)
+{
+    nodes_[order].next = free_;
+    free_ = order;
+    --size_;
+}
+
+OrderRequest OrderPool::request(OrderRef order) const
+{
+    const OrderNode &order_node = nodes_[order];
+    return {order_ids_[order], order_node.quantity, order_node.price};
+}
+
+size_t OrderPool::size() const
+{
+    return size_;
+}
@@ -0,0 +1,148 @@
+//
+//  order_pool.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 17.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef order_pool_hpp
+#define order_pool_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+#include "order_request.hpp"
+
+using namespace std;
+
+/** Reference to the order in its OrderPool */
+using OrderRef = uint32_t;
+
+/** Marks that there is no order */
+const OrderRef NO_ORDER = numeric_limits<OrderRef>::max();
+
+/**
+ * Order resting in the book. Holds only what the book updates are working
+ * with, the order id is kept apart in the pool. Is linked in to the FIFO
+ * of its price level by the references, so it is removed in constant time
+ * once found through the id index
+ */
+struct OrderNode
+{
+    /** Number of shares */
+    uint64_t quantity;
+
+    /** Price for one share in ticks */
+    Price price;
+
+    /** Previous order of the level. NO_ORDER for the oldest one */
+    OrderRef prev;
+
+    /** Next order of the level. NO_ORDER for the newest one */
+    OrderRef next;
+};
+
+/**
+ * Dense storage of the orders of one book side. Orders are addressed by the
+ * 32 bit references, which stay valid until the order is freed, even when
+ * the storage grows. Freed orders are reused first. Is not thread safe
+ */
+class OrderPool final
+{
+public:
+    /** Default constructor */
+    OrderPool() = default;
+
+    /** Default destructor */
+    ~OrderPool() = default;
+
+    /**
+     * Is used to store the new order. It is not linked to any level
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return reference to the order
+     */
+    OrderRef allocate(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Is used to free the order. The reference is not valid anymore
+     * @param order reference returned by allocate
+     */
+    void deallocate(OrderRef order);
+
+    /**
+     * Is used to get the book part of the order
+     * @param order reference returned by allocate
+     * @return node of the order
+     */
+    OrderNode & node(OrderRef order);
+
+    /**
+     * Same as above, but read only
+     * @param order reference returned by allocate
+     * @return node of the order
+     */
+    const OrderNode & node(OrderRef order) const;
+
+    /**
+     * Is used to get the id of the order
+     * @param order reference returned by allocate
+     * @return order unique identificator
+     */
+    uint64_t orderId(OrderRef order) const;
+
+    /**
+     * Is used to get the whole order
+     * @param order reference returned by allocate
+     * @return id, quantity and price of the order
+     */
+    OrderRequest request(OrderRef order) const;
+
+    /**
+     * Is used to get the number of the stored orders
+     * @return number of the orders
+     */
+    size_t size() const;
+
+private:
+    /** Book parts of the orders by reference */
+    vector<OrderNode> nodes_;
+
+    /** Ids of the orders by reference. Are kept apart as they are rarely read */
+    vector<uint64_t> order_ids_;
+
+    /** Most recently freed order. Freed orders are linked by next */
+    OrderRef free_ = NO_ORDER;
+
+    /** Number of the stored orders */
+    size_t size_ = 0;
+
+    PREVENT_COPY(OrderPool);
+    PREVENT_MOVE(OrderPool);
+};
+
+/**************************** Implementation **************************/
+
+inline OrderNode & OrderPool::node(OrderRef order)
+{
+    return nodes_[order];
+}
+
+inline const OrderNode & OrderPool::node(OrderRef order) const
+{
+    return nodes_[order];
+}
+
+inline uint64_t OrderPool::orderId(OrderRef order) const
+{
+    return order_ids_[order];
+}
+
+#endif /* order_pool_hpp */
@@ -15,22 +15,74 @@
 
 /************************* OrderRegistry ******************************/
 
+const SymbolTable & OrderRegistry::getSymbols() const
+{
+    return symbols_;
+}
+
+SymbolId OrderRegistry::internSymbol(string_view symbol)
+{
+    const SymbolId id = symbols_.intern(symbol);
+
+    if (id >= symbol_to_orders_bind_.size())
+    {
+        symbol_to_orders_bind_.resize(symbols_.size());
+        bbo_subscribers_.resize(symbols_.size());
+        vwap_subscribers_.resize(symbols_.size());
+    }
+
+    return id;
+}
+
+void OrderRegistry::setModifyPriority(ModifyPriority priority)
+{
+    modify_priority_ = priority;
+
+    for (auto &order_list : symbol_to_orders_bind_)
+    {
+        if (order_list)
+        {
+            order_list->setModifyPriority(priority);
+        }
+    }
+}
+
+ModifyPriority OrderRegistry::getModifyPriority() const
+{
+    return modify_priority_;
+}
+
+SymbolOrderList * OrderRegistry::findOrderList(SymbolId id)
+{
+    if (id >= symbol_to_orders_bind_.size())
+    {
+        return nullptr;
+    }
+
+    return symbol_to_orders_bind_[id].get();
+}
+
 OrdersActiveMap & OrderRegistry::getOrdersActive()
 {
     return orders_active_;
 }
 
-SymbolToOrdersMap & OrderRegistry::getSymbolToOrdersBind()
+const OrdersActiveMap & OrderRegistry::getOrdersActive() const
+{
+    return orders_active_;
+}
+
+SymbolToOrdersVector & OrderRegistry::getSymbolToOrdersBind()
 {
     return symbol_to_orders_bind_;
 }
 
-BboSubscribersMap & OrderRegistry::getBboSubscribers()
+BboSubscribersVector & OrderRegistry::getBboSubscribers()
 {
     return bbo_subscribers_;
 }
 
-VwapSubscribersMap & OrderRegistry::getVwapSubscribers()
+VwapSubscribersVector & OrderRegistry::getVwapSubscribers()
 {
     return vwap_subscribers_;
 }
@@ -12,40 +12,73 @@
 //System includes
 #include <unordered_map>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 //Local includes
 #include "defines.h"
 #include "symbol_order_list.hpp"
+#include "symbol_table.hpp"
+#include "order_id_table.hpp"
 
 using namespace std;
 
 /** Convinience definitions */
-using OrdersActiveMap = unordered_map<uint64_t, string>;
-using SymbolToOrdersMap = unordered_map<string, unique_ptr<SymbolOrderList>>;
-using BboSubscribersMap = unordered_map<string, uint32_t>;
-using VwapSubscribersMap = unordered_map<string, map<uint64_t, uint32_t>>;
+using OrdersActiveMap = OrderIdTable<OrderHandle>;
+using SymbolToOrdersVector = vector<unique_ptr<SymbolOrderList>>;
+using BboSubscribersVector = vector<optional<uint32_t>>;
+using VwapSubscribersVector = vector<map<uint64_t, uint32_t>>;
 
 /**
- * Order registry class. Implemented as singleton. Is used to hold
- * the order related data in one place. This is not ment to be used
- * in multiple threads at the same time
+ * Order registry class. Is used to hold the order related data of one
+ * replay in one place. Every MdProcessor owns its own registry, so the
+ * independent replays may run in one process. One registry is not ment
+ * to be used in multiple threads at the same time
  */
 class OrderRegistry final
 {
 public:
+    /** Default constructor */
+    OrderRegistry() = default;
+
     /** Default destructor */
     ~OrderRegistry() = default;
 
     /**
-     * Is used to get the single objects of this class
-     * @return the single object of this class
+     * Is used to get the table of all the symbols seen so far
+     * @return symbol table
+     */
+    const SymbolTable & getSymbols() const;
+
+    /**
+     * Is used to get the id of the symbol. New symbols get the empty slots
+     * in all the per symbol vectors
+     * @param symbol to look up
+     * @return id of the symbol
+     */
+    SymbolId internSymbol(string_view symbol);
+
+    /**
+     * Is used to set the rules for the place of the modified orders in the queue.
+     * Is applied to the existing and to the later order lists
+     * @param priority rules to use. MODIFY_REQUEUE by default
+     */
+    void setModifyPriority(ModifyPriority priority);
+
+    /**
+     * Is used to get the rules for the place of the modified orders in the queue
+     * @return rules in use
+     */
+    ModifyPriority getModifyPriority() const;
+
+    /**
+     * Is used to get the order list of the symbol
+     * @param id of the symbol. INVALID_SYMBOL_ID is accepted
+     * @return order list. Null if the symbol has no order list yet
      */
-    static OrderRegistry& get()
-    {
-        static OrderRegistry instance;
-        return instance;
-    }
+    SymbolOrderList * findOrderList(SymbolId id);
 
     /**
      * Is used to get the map of current active orders
@@ -54,41 +87,56 @@ public:
     OrdersActiveMap & getOrdersActive();
 
     /**
-     * Is used to get the map of current active symbol to order connections
-     * @return current map of the symbol to order connections
+     * Same as above, but read only
+     * @return current map of the active orders
      */
-    SymbolToOrdersMap & getSymbolToOrdersBind();
+    const OrdersActiveMap & getOrdersActive() const;
 
     /**
-    * Is used to get the map of current bbo subscribers
-    * @return current map of the bbo subscribers
+     * Is used to get the order lists of the symbols. Indexed by symbol id
+     * @return current order lists of the symbols
+     */
+    SymbolToOrdersVector & getSymbolToOrdersBind();
+
+    /**
+    * Is used to get the bbo subscribers. Indexed by symbol id
+    * @return current bbo subscribers
     */
-    BboSubscribersMap & getBboSubscribers();
+    BboSubscribersVector & getBboSubscribers();
 
     /**
-    * Is used to get the map of current vwap subscribers
-    * @return current map of the vwap subscribers
+    * Is used to get the vwap subscribers. Indexed by symbol id
+    * @return current vwap subscribers
     */
-    VwapSubscribersMap & getVwapSubscribers();
+    VwapSubscribersVector & getVwapSubscribers();
 
 private:
-    /** Default constructor */
-    OrderRegistry() = default;
+    /** All the symbols seen so far */
+    SymbolTable symbols_;
 
-    /** Current active orders. Key is an order id, value is a symbol */
+    /**
+     * Current active orders. Key is an order id, value is the handle of the order.
+     * This is the only index of the orders added through the registry
+     */
     OrdersActiveMap orders_active_;
 
     /** Current bindings of the symbols to the existing orders */
-    SymbolToOrdersMap symbol_to_orders_bind_;
+    SymbolToOrdersVector symbol_to_orders_bind_;
 
-    /** Current bbo subscribers map. Key is a symbol, value is a subscriber counter */
-    BboSubscribersMap bbo_subscribers_;
+    /** Rules for the place of the modified orders of all the symbols */
+    ModifyPriority modify_priority_ = MODIFY_REQUEUE;
+
+    /**
+    * Current bbo subscribers. Value is a subscriber counter. It is empty
+    * until the symbol was subscribed to or printed for the first time
+    */
+    BboSubscribersVector bbo_subscribers_;
 
     /**
-    * Current vwap subscribers map. Key is a symbol, value is a
-    * map with quantity as a key and subscriber counter as a value
+    * Current vwap subscribers. Value is a map with quantity as a key
+    * and subscriber counter as a value
     */
-    VwapSubscribersMap vwap_subscribers_;
+    VwapSubscribersVector vwap_subscribers_;
 
     PREVENT_COPY(OrderRegistry);
     PREVENT_MOVE(OrderRegistry);
@@ -33,7 +33,7 @@ ostream & operator<<(ostream &out, const OrderVwap &obj)
 {
     if (obj.buy_price != 0.0)
     {
-        out << '<' << fixed << setprecision(2) << obj.buy_price;
+        out << '<' << fixed << setprecision(2) << obj.buy_price / PRICE_SCALE;
     }
     else
     {
@@ -44,7 +44,7 @@ ostream & operator<<(ostream &out, const OrderVwap &obj)
 
     if (obj.sell_price != 0.0)
     {
-        out << fixed << setprecision(2) << obj.sell_price << '>';
+        out << fixed << setprecision(2) << obj.sell_price / PRICE_SCALE << '>';
     }
     else
     {
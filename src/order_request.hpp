@@ -13,6 +13,7 @@
 #include <ostream>
 
 //Local includes
+#include "price.hpp"
 
 using namespace std;
 
@@ -53,17 +54,20 @@ bool operator==(const OrderRequest &lhs, const OrderRequest &rhs);
 ostream & operator<<(ostream &out, const OrderVwap &obj);
 
 /**
- * Order Request class. Represents the single order
+ * Order Request class. Represents the single order. Price is kept in ticks,
+ * so the orders of one price level compare exactly equal
  */
 struct OrderRequest
 {
     uint64_t order_id;
     uint64_t quantity;
-    double price;
+    Price price;
 };
 
 /**
- * Order Vwap class. Represents the Vwap information
+ * Order Vwap class. Represents the Vwap information. Average is not on the
+ * tick grid, so the prices are the fractional number of ticks. Zero means
+ * there is no price
  */
 struct OrderVwap
 {
@@ -0,0 +1,162 @@
+//
+//  parallel_replay.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "parallel_replay.hpp"
+
+//System includes
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+//Local includes
+#include "md_decoder.hpp"
+#include "delimiter_scanner.hpp"
+
+using namespace std;
+using namespace md::processors;
+using namespace md::tokenizers;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Decoded chunk which waits to be applied */
+struct ChunkSlot
+{
+    /** Commands of the chunk in the file order */
+    vector<MdCommand> commands;
+
+    /** Is set by the worker once the chunk is decoded */
+    bool ready = false;
+};
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+ParallelReplay::ParallelReplay(MdProcessor &processor, size_t threads, size_t chunk_size) :
+    processor_(processor),
+    threads_(threads != 0 ? threads : max(1u, thread::hardware_concurrency())),
+    chunk_size_(max<size_t>(chunk_size, 1))
+{
+}
+
+vector<string_view> ParallelReplay::SplitChunks(string_view data, size_t chunk_size)
+{
+    vector<string_view> chunks;
+
+    size_t begin = 0;
+
+    while (begin < data.size())
+    {
+        size_t end = min(begin + chunk_size, data.size());
+
+        if (end < data.size())
+        {
+            //Stretch the chunk up to the end of the line
+            const void *newline = memchr(data.data() + end - 1, '\n', data.size() - end + 1);
+            end = newline ? static_cast<const char *>(newline) - data.data() + 1 : data.size();
+        }
+
+        chunks.push_back(data.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return chunks;
+}
+
+void ParallelReplay::run(string_view data, const FailureHandler &on_failure)
+{
+    const vector<string_view> chunks = SplitChunks(data, chunk_size_);
+
+    //Workers may run this far ahead of the applying thread
+    const size_t ring_size = threads_ * 2;
+    vector<ChunkSlot> slots(ring_size);
+
+    mutex lock;
+    condition_variable work_cv, ready_cv;
+    size_t next = 0, applied = 0;
+
+    auto worker = [&]()
+    {
+        MdDecoder decoder;
+        BlockTokenizer tokenizer;
+
+        for (;;)
+        {
+            size_t index = 0;
+
+            {
+                unique_lock<mutex> guard(lock);
+                work_cv.wait(guard, [&]{ return next >= chunks.size() || next < applied + ring_size; });
+
+                if (next >= chunks.size())
+                {
+                    return;
+                }
+
+                index = next++;
+            }
+
+            ChunkSlot &slot = slots[index % ring_size];
+            slot.commands.clear();
+
+            tokenizer.forEachLine(chunks[index], [&](string_view line, const TokenList &tokens)
+            {
+                slot.commands.emplace_back();
+                decoder.decode(line, tokens, slot.commands.back());
+            });
+
+            {
+                lock_guard<mutex> guard(lock);
+                slot.ready = true;
+            }
+
+            ready_cv.notify_one();
+        }
+    };
+
+    vector<thread> workers;
+    workers.reserve(threads_);
+
+    for (size_t i = 0; i < threads_; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        ChunkSlot &slot = slots[index % ring_size];
+
+        {
+            unique_lock<mutex> guard(lock);
+            ready_cv.wait(guard, [&]{ return slot.ready; });
+        }
+
+        processor_.processBatch(slot.commands.data(), slot.commands.size(), [&on_failure](const MdCommand &command)
+        {
+            on_failure(command.line);
+        });
+
+        {
+            lock_guard<mutex> guard(lock);
+            slot.ready = false;
+            ++applied;
+        }
+
+        work_cv.notify_all();
+    }
+
+    for (auto &thread : workers)
+    {
+        thread.join();
+    }
+}
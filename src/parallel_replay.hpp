@@ -0,0 +1,87 @@
+//
+//  parallel_replay.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef parallel_replay_hpp
+#define parallel_replay_hpp
+
+//System includes
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+#include "md_processor.hpp"
+
+namespace md
+{
+namespace processors
+{
+
+using namespace std;
+
+/**
+ * Replays the text feed with the parsing spread over the worker threads. The
+ * input is split in to the newline aligned chunks, workers decode the chunks
+ * in to the commands and the calling thread applies them in the file order.
+ * Output is the same as for the line by line processing.
+ */
+class ParallelReplay
+{
+public:
+    /** Default size of one chunk in bytes */
+    static const size_t DEFAULT_CHUNK = 1 << 20;
+
+    /** Is called on the calling thread for every line which failed */
+    using FailureHandler = function<void(string_view line)>;
+
+    /**
+     * Constructor
+     * @param processor where to apply the commands
+     * @param threads number of the parsing threads. Zero means one per core
+     * @param chunk_size approximate size of one chunk in bytes
+     */
+    ParallelReplay(MdProcessor &processor, size_t threads, size_t chunk_size = DEFAULT_CHUNK);
+
+    /** Default destructor */
+    ~ParallelReplay() = default;
+
+    /**
+     * Is used to replay the whole feed. Returns when every line was applied
+     * @param data content of the feed
+     * @param on_failure is called for every line which the processor failed to handle
+     */
+    void run(string_view data, const FailureHandler &on_failure);
+
+    /**
+     * Is used to split the feed in to the newline aligned chunks
+     * @param data content of the feed
+     * @param chunk_size approximate size of one chunk in bytes
+     * @return chunks. Each one but the last ends right after the newline
+     */
+    static vector<string_view> SplitChunks(string_view data, size_t chunk_size);
+
+private:
+    /** Where to apply the commands */
+    MdProcessor &processor_;
+
+    /** Number of the parsing threads */
+    size_t threads_;
+
+    /** Approximate size of one chunk in bytes */
+    size_t chunk_size_;
+
+    PREVENT_COPY(ParallelReplay);
+    PREVENT_MOVE(ParallelReplay);
+};
+
+} // namespace processors
+} // namespace md
+
+#endif /* parallel_replay_hpp */
@@ -0,0 +1,38 @@
+//
+//  price.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 06.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef price_hpp
+#define price_hpp
+
+//System includes
+#include <cstdint>
+
+//Local includes
+
+using namespace std;
+
+/** Fixed point price. Is measured in ticks of 1/PRICE_SCALE of the currency unit */
+using Price = int64_t;
+
+/** Number of the decimal digits after the point which a price can have */
+const int PRICE_DECIMALS = 4;
+
+/** Number of ticks in one currency unit */
+const Price PRICE_SCALE = 10000;
+
+/**
+ * Is used to convert the fixed point price to the floating point one
+ * @param price in ticks
+ * @return price in the currency units
+ */
+inline double PriceToDouble(Price price)
+{
+    return static_cast<double>(price) / PRICE_SCALE;
+}
+
+#endif /* price_hpp */
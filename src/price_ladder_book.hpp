@@ -0,0 +1,748 @@
+//
+//  price_ladder_book.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 15.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef price_ladder_book_hpp
+#define price_ladder_book_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <vector>
+
+//Local includes
+#include "defines.h"
+#include "depth_index.hpp"
+#include "price_level_book.hpp"
+
+using namespace std;
+
+/**
+ * One side of the order book kept as an array of the price levels indexed
+ * by the tick offset from the anchor price. The window of the array is
+ * centred on the best price, so the add, cancel and best price lookup near
+ * the touch are array indexing. Levels outside of the window are kept in
+ * the sorted map. The window is moved once the best price leaves it.
+ * Has the same interface as PriceLevelBook, the levels are walked from the
+ * best one by Compare. Once the depth is asked for, the window levels are
+ * also kept in the DepthIndex
+ */
+template <typename Compare>
+class PriceLadderBook
+{
+public:
+    /** Number of the price levels in the window */
+    static constexpr size_t LADDER_SIZE = 1024;
+
+    /** Forward iterator over the levels from the best one */
+    class const_iterator
+    {
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = PriceLevel;
+        using difference_type = ptrdiff_t;
+        using pointer = const PriceLevel *;
+        using reference = const PriceLevel &;
+
+        /** Default constructor */
+        const_iterator() = default;
+
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator & operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator &rhs) const;
+        bool operator!=(const const_iterator &rhs) const;
+
+    private:
+        friend class PriceLadderBook;
+
+        /** Iterator over the sparse levels */
+        using SparseIterator = typename PriceLevelMap<Compare>::const_iterator;
+
+        /**
+         * Constructor
+         * @param book which levels to walk
+         * @param slot first window level to visit. NO_SLOT if none
+         * @param sparse first sparse level to visit
+         */
+        const_iterator(const PriceLadderBook *book, size_t slot, SparseIterator sparse);
+
+        /** Is used to pick the level which goes first of the two candidates */
+        void settle();
+
+        /** Book which levels are walked */
+        const PriceLadderBook *book_ = nullptr;
+
+        /** Next window level to visit. NO_SLOT if none */
+        size_t slot_ = 0;
+
+        /** Next sparse level to visit */
+        SparseIterator sparse_;
+
+        /** Current level. Null at the end */
+        const PriceLevel *current_ = nullptr;
+
+        /** Whether the current level is the window one */
+        bool in_window_ = false;
+    };
+
+    /** Default constructor */
+    PriceLadderBook();
+
+    /** Default destructor. The orders are freed with the pools */
+    ~PriceLadderBook() = default;
+
+    /**
+     * Is used to put the order at the end of its price level
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return reference to the order. Is valid until it is erased
+     */
+    OrderRef insert(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Is used to remove the order from the book
+     * @param order reference returned by insert
+     */
+    void erase(OrderRef order);
+
+    /**
+     * Is used to change the quantity of the order. The price is not changed,
+     * so the order stays in its level
+     * @param order reference returned by insert
+     * @param quantity new number of shares
+     * @param keep_priority true to keep the place of the order in the level
+     */
+    void amend(OrderRef order, uint64_t quantity, bool keep_priority);
+
+    /**
+     * Is used to get the orders of this side
+     * @return storage of the orders
+     */
+    const OrderPool & orders() const;
+
+    /**
+     * Is used to check whether or not the book has any orders
+     * @return true if empty
+     */
+    bool empty() const;
+
+    /**
+     * Is used to get the best price level. The book must not be empty
+     * @return best level
+     */
+    const PriceLevel & best() const;
+
+    /**
+     * Is used to get the number of the price levels
+     * @return number of the levels
+     */
+    size_t levelCount() const;
+
+    /**
+     * Is used to get the number of the price levels outside of the window
+     * @return number of the sparse levels
+     */
+    size_t sparseLevelCount() const;
+
+    /**
+     * Is used to get the price times quantity of the best shares of the side.
+     * The first call builds the depth index, which is kept up to date after it
+     * @param quantity number of the shares to cover
+     * @return sum in ticks. All the levels if the side holds less than quantity
+     */
+    uint64_t depthNotional(uint64_t quantity);
+
+    /**
+     * Is used to get the best level
+     * @return iterator to the best level
+     */
+    const_iterator begin() const;
+
+    /**
+     * Is used to get the end of the levels
+     * @return iterator past the worst level
+     */
+    const_iterator end() const;
+
+private:
+    /** Sorted map of the levels outside of the window */
+    using SparseMap = PriceLevelMap<Compare>;
+
+    /** Number of the slots in one word of the occupied bitmap */
+    static constexpr size_t WORD_BITS = 64;
+
+    /** Marks that there is no window level */
+    static constexpr size_t NO_SLOT = LADDER_SIZE;
+
+    /** Whether the window is walked from the highest slot */
+    static constexpr bool HIGH_FIRST = Compare()(Price(1), Price(0));
+
+    /**
+     * Is used to check whether or not the price is inside of the window
+     * @param price in ticks
+     * @return true if inside
+     */
+    bool inWindow(Price price) const;
+
+    /**
+     * Is used to get the occupied slot which follows the given one by Compare
+     * @param slot to start after
+     * @return slot. NO_SLOT if there are no more
+     */
+    size_t nextSlot(size_t slot) const;
+
+    /**
+     * Is used to find the lowest occupied slot starting from the given one
+     * @param from first slot to check
+     * @return slot. NO_SLOT if none
+     */
+    size_t occupiedFrom(size_t from) const;
+
+    /**
+     * Is used to find the highest occupied slot below the given one
+     * @param before slot after the last one to check
+     * @return slot. NO_SLOT if none
+     */
+    size_t occupiedBefore(size_t before) const;
+
+    /**
+     * Is used to get the window level of the price. Is made occupied if needed
+     * @param price inside of the window
+     * @return level
+     */
+    PriceLevel & windowLevel(Price price);
+
+    /**
+     * Is used to get the existing level of the price
+     * @param price of the level
+     * @return level
+     */
+    PriceLevel & levelOf(Price price);
+
+    /**
+     * Is used to centre the window on the price. Levels which leave the window
+     * go to the sparse map, sparse levels which get in to the window are moved
+     * to the array
+     * @param price new centre of the window
+     */
+    void recentre(Price price);
+
+    /**
+     * Is used to tell the depth index that the quantity of the level has changed
+     * @param price of the level
+     * @param old_quantity quantity of the level before the change
+     * @param new_quantity quantity of the level after the change
+     */
+    void trackDepth(Price price, uint64_t old_quantity, uint64_t new_quantity);
+
+    /**
+     * Is used to put all the window levels in to the depth index
+     */
+    void rebuildDepth();
+
+    /**
+     * Is used to get the running sums of the sparse levels up to date
+     */
+    void rebuildSparseDepth();
+
+    /** Levels of the window. Is allocated with the first order */
+    vector<PriceLevel> slots_;
+
+    /** Bitmap of the slots which hold any orders */
+    vector<uint64_t> occupied_;
+
+    /** Price of the first slot */
+    Price anchor_ = 0;
+
+    /** Number of the occupied slots */
+    size_t window_levels_ = 0;
+
+    /** Best occupied slot. NO_SLOT if the window is empty */
+    size_t best_slot_ = NO_SLOT;
+
+    /** Storage of the orders of this side */
+    OrderPool orders_;
+
+    /** Storage of the sparse levels of this side */
+    NodePool level_pool_;
+
+    /** Levels outside of the window */
+    SparseMap sparse_;
+
+    /** Quantities of the window levels. The best slot goes first */
+    DepthIndex depth_;
+
+    /** Whether the depth index is kept up to date */
+    bool depth_enabled_ = false;
+
+    /** Running sums of the sparse levels from the best one */
+    vector<DepthStep> sparse_depth_;
+
+    /** Number of the sparse levels which are better than the window */
+    size_t sparse_better_ = 0;
+
+    /** Whether the running sums of the sparse levels are up to date */
+    bool sparse_depth_valid_ = false;
+
+    PREVENT_COPY(PriceLadderBook);
+};
+
+/** Buy side. The highest price goes first */
+using BidBook = PriceLadderBook<greater<Price>>;
+
+/** Sell side. The lowest price goes first */
+using AskBook = PriceLadderBook<less<Price>>;
+
+/**************************** Implementation **************************/
+
+template <typename Compare>
+PriceLadderBook<Compare>::PriceLadderBook() :
+    sparse_(typename SparseMap::allocator_type(&level_pool_))
+{
+}
+
+template <typename Compare>
+OrderRef PriceLadderBook<Compare>::insert(uint64_t order_id, uint64_t quantity, Price price)
+{
+    if (!inWindow(price) && (window_levels_ == 0 || Compare()(price, slots_[best_slot_].price)))
+    {
+        // Best price has left the window
+        recentre(price);
+    }
+
+    const OrderRef order = orders_.allocate(order_id, quantity, price);
+
+    PriceLevel &level = inWindow(price) ? windowLevel(price) :
+        sparse_.try_emplace(price, PriceLevel{price, 0, 0, NO_ORDER, NO_ORDER}).first->second;
+
+    PushOrder(orders_, level, order);
+    trackDepth(price, level.total_quantity - quantity, level.total_quantity);
+
+    return order;
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::erase(OrderRef order)
+{
+    PriceLevel &level = levelOf(orders_.node(order).price);
+    const uint64_t old_quantity = level.total_quantity;
+
+    UnlinkOrder(orders_, level, order);
+    orders_.deallocate(order);
+    trackDepth(level.price, old_quantity, level.total_quantity);
+
+    if (level.order_count != 0)
+    {
+        return;
+    }
+
+    if (!inWindow(level.price))
+    {
+        sparse_.erase(level.price);
+        return;
+    }
+
+    size_t slot = level.price - anchor_;
+    occupied_[slot / WORD_BITS] &= ~(uint64_t(1) << (slot % WORD_BITS));
+    --window_levels_;
+
+    if (slot == best_slot_)
+    {
+        best_slot_ = nextSlot(slot);
+    }
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::amend(OrderRef order, uint64_t quantity, bool keep_priority)
+{
+    PriceLevel &level = levelOf(orders_.node(order).price);
+    const uint64_t old_quantity = level.total_quantity;
+
+    AmendOrder(orders_, level, order, quantity, keep_priority);
+    trackDepth(level.price, old_quantity, level.total_quantity);
+}
+
+template <typename Compare>
+const OrderPool & PriceLadderBook<Compare>::orders() const
+{
+    return orders_;
+}
+
+template <typename Compare>
+bool PriceLadderBook<Compare>::empty() const
+{
+    return window_levels_ == 0 && sparse_.empty();
+}
+
+template <typename Compare>
+const PriceLevel & PriceLadderBook<Compare>::best() const
+{
+    if (window_levels_ == 0)
+    {
+        return sparse_.begin()->second;
+    }
+
+    const PriceLevel &window_best = slots_[best_slot_];
+
+    if (!sparse_.empty() && Compare()(sparse_.begin()->first, window_best.price))
+    {
+        return sparse_.begin()->second;
+    }
+
+    return window_best;
+}
+
+template <typename Compare>
+size_t PriceLadderBook<Compare>::levelCount() const
+{
+    return window_levels_ + sparse_.size();
+}
+
+template <typename Compare>
+size_t PriceLadderBook<Compare>::sparseLevelCount() const
+{
+    return sparse_.size();
+}
+
+template <typename Compare>
+uint64_t PriceLadderBook<Compare>::depthNotional(uint64_t quantity)
+{
+    if (!depth_enabled_)
+    {
+        depth_enabled_ = true;
+        rebuildDepth();
+    }
+
+    if (!sparse_depth_valid_)
+    {
+        rebuildSparseDepth();
+    }
+
+    // Levels are walked as the better sparse ones, the window, the worse sparse ones
+    const uint64_t better_quantity = sparse_better_ != 0 ? sparse_depth_[sparse_better_ - 1].quantity : 0;
+    const uint64_t better_notional = sparse_better_ != 0 ? sparse_depth_[sparse_better_ - 1].notional : 0;
+
+    if (quantity <= better_quantity)
+    {
+        return DepthNotional(sparse_depth_, quantity);
+    }
+
+    const uint64_t window_quantity = quantity - better_quantity;
+
+    if (window_quantity > depth_.totalQuantity())
+    {
+        // Running sums of the worse sparse levels include the better ones
+        return depth_.totalNotional() + DepthNotional(sparse_depth_, quantity - depth_.totalQuantity());
+    }
+
+    uint64_t covered_quantity, covered_notional;
+    const size_t position = depth_.search(window_quantity, covered_quantity, covered_notional);
+    const size_t slot = HIGH_FIRST ? LADDER_SIZE - 1 - position : position;
+
+    return better_notional + covered_notional +
+        static_cast<uint64_t>(slots_[slot].price) * (window_quantity - covered_quantity);
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator PriceLadderBook<Compare>::begin() const
+{
+    return const_iterator(this, best_slot_, sparse_.begin());
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator PriceLadderBook<Compare>::end() const
+{
+    return const_iterator(this, NO_SLOT, sparse_.end());
+}
+
+template <typename Compare>
+bool PriceLadderBook<Compare>::inWindow(Price price) const
+{
+    return !slots_.empty() && price >= anchor_ && price - anchor_ < static_cast<Price>(LADDER_SIZE);
+}
+
+template <typename Compare>
+size_t PriceLadderBook<Compare>::nextSlot(size_t slot) const
+{
+    return HIGH_FIRST ? occupiedBefore(slot) : occupiedFrom(slot + 1);
+}
+
+template <typename Compare>
+size_t PriceLadderBook<Compare>::occupiedFrom(size_t from) const
+{
+    size_t word = from / WORD_BITS;
+
+    if (word >= occupied_.size())
+    {
+        return NO_SLOT;
+    }
+
+    uint64_t bits = occupied_[word] & (~uint64_t(0) << (from % WORD_BITS));
+
+    while (bits == 0)
+    {
+        if (++word == occupied_.size())
+        {
+            return NO_SLOT;
+        }
+
+        bits = occupied_[word];
+    }
+
+    return word * WORD_BITS + __builtin_ctzll(bits);
+}
+
+template <typename Compare>
+size_t PriceLadderBook<Compare>::occupiedBefore(size_t before) const
+{
+    if (before == 0 || occupied_.empty())
+    {
+        return NO_SLOT;
+    }
+
+    size_t last = before - 1;
+    size_t word = last / WORD_BITS;
+    uint64_t bits = occupied_[word] & (~uint64_t(0) >> (WORD_BITS - 1 - last % WORD_BITS));
+
+    while (bits == 0)
+    {
+        if (word == 0)
+        {
+            return NO_SLOT;
+        }
+
+        bits = occupied_[--word];
+    }
+
+    return word * WORD_BITS + WORD_BITS - 1 - __builtin_clzll(bits);
+}
+
+template <typename Compare>
+PriceLevel & PriceLadderBook<Compare>::windowLevel(Price price)
+{
+    size_t slot = price - anchor_;
+    PriceLevel &level = slots_[slot];
+
+    if (level.order_count == 0)
+    {
+        level = PriceLevel{price, 0, 0, NO_ORDER, NO_ORDER};
+        occupied_[slot / WORD_BITS] |= uint64_t(1) << (slot % WORD_BITS);
+        ++window_levels_;
+
+        if (best_slot_ == NO_SLOT || Compare()(price, slots_[best_slot_].price))
+        {
+            best_slot_ = slot;
+        }
+    }
+
+    return level;
+}
+
+template <typename Compare>
+PriceLevel & PriceLadderBook<Compare>::levelOf(Price price)
+{
+    if (inWindow(price))
+    {
+        return slots_[price - anchor_];
+    }
+
+    return sparse_.find(price)->second;
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::recentre(Price price)
+{
+    vector<PriceLevel> old_slots(LADDER_SIZE);
+    vector<uint64_t> old_occupied(LADDER_SIZE / WORD_BITS, 0);
+
+    slots_.swap(old_slots);
+    occupied_.swap(old_occupied);
+
+    anchor_ = price - static_cast<Price>(LADDER_SIZE / 2);
+    window_levels_ = 0;
+    best_slot_ = NO_SLOT;
+
+    // Old window levels go to the new window or to the sparse map
+    for (size_t word = 0; word < old_occupied.size(); ++word)
+    {
+        for (uint64_t bits = old_occupied[word]; bits != 0; bits &= bits - 1)
+        {
+            PriceLevel &old_level = old_slots[word * WORD_BITS + __builtin_ctzll(bits)];
+
+            if (inWindow(old_level.price))
+            {
+                windowLevel(old_level.price) = old_level;
+            }
+            else
+            {
+                sparse_.emplace(old_level.price, old_level);
+            }
+        }
+    }
+
+    // Sparse levels of the new window are contiguous in the map
+    Price window_first = HIGH_FIRST ? anchor_ + static_cast<Price>(LADDER_SIZE) - 1 : anchor_;
+    auto sparse_level = sparse_.lower_bound(window_first);
+
+    while (sparse_level != sparse_.end() && inWindow(sparse_level->first))
+    {
+        windowLevel(sparse_level->first) = sparse_level->second;
+        sparse_level = sparse_.erase(sparse_level);
+    }
+
+    if (depth_enabled_)
+    {
+        rebuildDepth();
+    }
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::trackDepth(Price price, uint64_t old_quantity, uint64_t new_quantity)
+{
+    if (!depth_enabled_)
+    {
+        return;
+    }
+
+    if (!inWindow(price))
+    {
+        sparse_depth_valid_ = false;
+        return;
+    }
+
+    const size_t slot = price - anchor_;
+    depth_.update(HIGH_FIRST ? LADDER_SIZE - 1 - slot : slot, old_quantity, new_quantity, price);
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::rebuildDepth()
+{
+    depth_.reset(LADDER_SIZE);
+    sparse_depth_valid_ = false;
+
+    for (size_t word = 0; word < occupied_.size(); ++word)
+    {
+        for (uint64_t bits = occupied_[word]; bits != 0; bits &= bits - 1)
+        {
+            const size_t slot = word * WORD_BITS + __builtin_ctzll(bits);
+            const PriceLevel &level = slots_[slot];
+
+            depth_.update(HIGH_FIRST ? LADDER_SIZE - 1 - slot : slot, 0, level.total_quantity, level.price);
+        }
+    }
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::rebuildSparseDepth()
+{
+    uint64_t quantity = 0, notional = 0;
+
+    sparse_depth_.clear();
+    sparse_better_ = 0;
+
+    for (const auto &level : sparse_)
+    {
+        quantity += level.second.total_quantity;
+        notional += static_cast<uint64_t>(level.first) * level.second.total_quantity;
+        sparse_depth_.push_back({level.first, quantity, notional});
+
+        if (Compare()(level.first, anchor_))
+        {
+            ++sparse_better_;
+        }
+    }
+
+    sparse_depth_valid_ = true;
+}
+
+/************************** const_iterator ****************************/
+
+template <typename Compare>
+PriceLadderBook<Compare>::const_iterator::const_iterator(const PriceLadderBook *book, size_t slot,
+                                                         SparseIterator sparse) :
+    book_(book), slot_(slot), sparse_(sparse)
+{
+    settle();
+}
+
+template <typename Compare>
+void PriceLadderBook<Compare>::const_iterator::settle()
+{
+    bool sparse_left = sparse_ != book_->sparse_.end();
+
+    if (slot_ == NO_SLOT)
+    {
+        in_window_ = false;
+        current_ = sparse_left ? &sparse_->second : nullptr;
+        return;
+    }
+
+    const PriceLevel &window_level = book_->slots_[slot_];
+
+    in_window_ = !sparse_left || Compare()(window_level.price, sparse_->first);
+    current_ = in_window_ ? &window_level : &sparse_->second;
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator::reference
+PriceLadderBook<Compare>::const_iterator::operator*() const
+{
+    return *current_;
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator::pointer
+PriceLadderBook<Compare>::const_iterator::operator->() const
+{
+    return current_;
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator &
+PriceLadderBook<Compare>::const_iterator::operator++()
+{
+    if (in_window_)
+    {
+        slot_ = book_->nextSlot(slot_);
+    }
+    else
+    {
+        ++sparse_;
+    }
+
+    settle();
+    return *this;
+}
+
+template <typename Compare>
+typename PriceLadderBook<Compare>::const_iterator
+PriceLadderBook<Compare>::const_iterator::operator++(int)
+{
+    const_iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template <typename Compare>
+bool PriceLadderBook<Compare>::const_iterator::operator==(const const_iterator &rhs) const
+{
+    return current_ == rhs.current_;
+}
+
+template <typename Compare>
+bool PriceLadderBook<Compare>::const_iterator::operator!=(const const_iterator &rhs) const
+{
+    return !(*this == rhs);
+}
+
+#endif /* price_ladder_book_hpp */
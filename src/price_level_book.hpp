@@ -0,0 +1,314 @@
+//
+//  price_level_book.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 14.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef price_level_book_hpp
+#define price_level_book_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+
+//Local includes
+#include "defines.h"
+#include "node_pool.hpp"
+#include "order_pool.hpp"
+#include "order_request.hpp"
+
+using namespace std;
+
+/**
+ * All the orders of one price. Totals are kept up to date on every change,
+ * so the level is read without walking its orders
+ */
+struct PriceLevel
+{
+    /** Price of the level in ticks */
+    Price price;
+
+    /** Sum of the quantities of the orders */
+    uint64_t total_quantity;
+
+    /** Number of the orders */
+    uint32_t order_count;
+
+    /** Oldest order */
+    OrderRef head;
+
+    /** Newest order */
+    OrderRef tail;
+};
+
+/**
+ * Is used to put the order at the end of the level. Totals are updated
+ * @param orders where the order is stored
+ * @param level where to put the order
+ * @param order reference to the order. Its links are set here
+ */
+inline void PushOrder(OrderPool &orders, PriceLevel &level, OrderRef order)
+{
+    OrderNode &node = orders.node(order);
+
+    node.prev = level.tail;
+    node.next = NO_ORDER;
+
+    if (level.tail != NO_ORDER)
+    {
+        orders.node(level.tail).next = order;
+    }
+    else
+    {
+        level.head = order;
+    }
+
+    level.tail = order;
+    level.total_quantity += node.quantity;
+    ++level.order_count;
+}
+
+/**
+ * Is used to take the order out of its level. Totals are updated,
+ * the order itself is not freed
+ * @param orders where the order is stored
+ * @param level which holds the order
+ * @param order reference to the order
+ */
+inline void UnlinkOrder(OrderPool &orders, PriceLevel &level, OrderRef order)
+{
+    const OrderNode &node = orders.node(order);
+
+    if (node.prev != NO_ORDER)
+    {
+        orders.node(node.prev).next = node.next;
+    }
+    else
+    {
+        level.head = node.next;
+    }
+
+    if (node.next != NO_ORDER)
+    {
+        orders.node(node.next).prev = node.prev;
+    }
+    else
+    {
+        level.tail = node.prev;
+    }
+
+    level.total_quantity -= node.quantity;
+    --level.order_count;
+}
+
+/**
+ * Is used to change the quantity of the order within its level. Totals are updated
+ * @param orders where the order is stored
+ * @param level which holds the order
+ * @param order reference to the order
+ * @param quantity new number of shares
+ * @param keep_priority true to keep the place of the order in the level,
+ *                      false to put it at the end
+ */
+inline void AmendOrder(OrderPool &orders, PriceLevel &level, OrderRef order, uint64_t quantity, bool keep_priority)
+{
+    OrderNode &node = orders.node(order);
+
+    if (keep_priority)
+    {
+        level.total_quantity = level.total_quantity - node.quantity + quantity;
+        node.quantity = quantity;
+        return;
+    }
+
+    UnlinkOrder(orders, level, order);
+    node.quantity = quantity;
+    PushOrder(orders, level, order);
+}
+
+/**
+ * Allocator of the level map nodes of the books. Has to be constructible
+ * from the NodePool pointer
+ */
+template <typename T>
+using LevelAllocator = PoolAllocator<T>;
+
+/** Map of the price levels sorted by Compare */
+template <typename Compare>
+using PriceLevelMap = map<Price, PriceLevel, Compare, LevelAllocator<pair<const Price, PriceLevel>>>;
+
+/**
+ * One side of the order book made of the price levels. Levels are sorted
+ * by Compare, so the best one is always the first. Orders of one level are
+ * kept in the arrival order
+ */
+template <typename Compare>
+class PriceLevelBook
+{
+public:
+    /** Levels by price */
+    using LevelMap = PriceLevelMap<Compare>;
+
+    /** Iterator over the levels from the best one */
+    using const_iterator = typename LevelMap::const_iterator;
+
+    /** Default constructor */
+    PriceLevelBook();
+
+    /** Default destructor. The orders are freed with the pools */
+    ~PriceLevelBook() = default;
+
+    /**
+     * Is used to put the order at the end of its price level
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return reference to the order. Is valid until it is erased
+     */
+    OrderRef insert(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Is used to remove the order from the book
+     * @param order reference returned by insert
+     */
+    void erase(OrderRef order);
+
+    /**
+     * Is used to change the quantity of the order. The price is not changed,
+     * so the order stays in its level
+     * @param order reference returned by insert
+     * @param quantity new number of shares
+     * @param keep_priority true to keep the place of the order in the level
+     */
+    void amend(OrderRef order, uint64_t quantity, bool keep_priority);
+
+    /**
+     * Is used to get the orders of this side
+     * @return storage of the orders
+     */
+    const OrderPool & orders() const;
+
+    /**
+     * Is used to check whether or not the book has any orders
+     * @return true if empty
+     */
+    bool empty() const;
+
+    /**
+     * Is used to get the best price level. The book must not be empty
+     * @return best level
+     */
+    const PriceLevel & best() const;
+
+    /**
+     * Is used to get the number of the price levels
+     * @return number of the levels
+     */
+    size_t levelCount() const;
+
+    /**
+     * Is used to get the best level
+     * @return iterator to the best level
+     */
+    const_iterator begin() const;
+
+    /**
+     * Is used to get the end of the levels
+     * @return iterator past the worst level
+     */
+    const_iterator end() const;
+
+private:
+    /** Storage of the orders of this side */
+    OrderPool orders_;
+
+    /** Storage of the price levels of this side */
+    NodePool level_pool_;
+
+    /** Price levels of this side */
+    LevelMap levels_;
+
+    PREVENT_COPY(PriceLevelBook);
+};
+
+/**************************** Implementation **************************/
+
+template <typename Compare>
+PriceLevelBook<Compare>::PriceLevelBook() :
+    levels_(typename LevelMap::allocator_type(&level_pool_))
+{
+}
+
+template <typename Compare>
+OrderRef PriceLevelBook<Compare>::insert(uint64_t order_id, uint64_t quantity, Price price)
+{
+    auto added = levels_.try_emplace(price, PriceLevel{price, 0, 0, NO_ORDER, NO_ORDER});
+
+    const OrderRef order = orders_.allocate(order_id, quantity, price);
+    PushOrder(orders_, added.first->second, order);
+
+    return order;
+}
+
+template <typename Compare>
+void PriceLevelBook<Compare>::erase(OrderRef order)
+{
+    auto level = levels_.find(orders_.node(order).price);
+
+    UnlinkOrder(orders_, level->second, order);
+
+    if (level->second.order_count == 0)
+    {
+        levels_.erase(level);
+    }
+
+    orders_.deallocate(order);
+}
+
+template <typename Compare>
+void PriceLevelBook<Compare>::amend(OrderRef order, uint64_t quantity, bool keep_priority)
+{
+    AmendOrder(orders_, levels_.find(orders_.node(order).price)->second, order, quantity, keep_priority);
+}
+
+template <typename Compare>
+const OrderPool & PriceLevelBook<Compare>::orders() const
+{
+    return orders_;
+}
+
+template <typename Compare>
+bool PriceLevelBook<Compare>::empty() const
+{
+    return levels_.empty();
+}
+
+template <typename Compare>
+const PriceLevel & PriceLevelBook<Compare>::best() const
+{
+    return levels_.begin()->second;
+}
+
+template <typename Compare>
+size_t PriceLevelBook<Compare>::levelCount() const
+{
+    return levels_.size();
+}
+
+template <typename Compare>
+typename PriceLevelBook<Compare>::const_iterator PriceLevelBook<Compare>::begin() const
+{
+    return levels_.begin();
+}
+
+template <typename Compare>
+typename PriceLevelBook<Compare>::const_iterator PriceLevelBook<Compare>::end() const
+{
+    return levels_.end();
+}
+
+#endif /* price_level_book_hpp */
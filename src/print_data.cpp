@@ -9,7 +9,6 @@
 #include "print_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -18,7 +17,7 @@ using namespace md::tokenizers;
 
 
 PrintData::PrintData(const string &command) :
-    symbol_(""),
+    symbol_(),
     command_(command)
 {
 }
@@ -39,42 +38,29 @@ PrintData & PrintData::operator=(const PrintData &obj)
     return *this;
 }
 
-void PrintData::processTokens(const vector<string> &tokens)
+void PrintData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != PrintIndex::SIZE)
     {
-        if (tokens.size() != PrintIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != command_)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        symbol_ = tokens.at(PrintIndex::SYMBOL);
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != command_)
     {
-        cerr << "PrintData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    symbol_ = tokens[PrintIndex::SYMBOL];
+
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
-const string & PrintData::getSymbol()
+string_view PrintData::getSymbol()
 {
     return symbol_;
 }
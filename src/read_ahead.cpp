@@ -0,0 +1,223 @@
+//
+//  read_ahead.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 09.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "read_ahead.hpp"
+
+//System includes
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+
+//Local includes
+
+using namespace std;
+using namespace md::readers;
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/** Alignment of the buffers */
+const size_t BUFFER_ALIGNMENT = 4096;
+
+/**
+ * Is used to wait for the other side of the ring without the locks. Spins for
+ * a short while, then starts sleeping so the idle side does not burn the core
+ * @param ready predicate to wait for
+ */
+template <typename Predicate>
+void WaitFor(Predicate ready)
+{
+    for (unsigned attempt = 0; !ready(); ++attempt)
+    {
+        if (attempt < 64)
+        {
+            this_thread::yield();
+        }
+        else
+        {
+            this_thread::sleep_for(chrono::microseconds(50));
+        }
+    }
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+ReadAheadReader::ReadAheadReader(size_t buffer_size) :
+    buffer_size_(max<size_t>(buffer_size, 1)),
+    produced_(0),
+    consumed_(0),
+    eof_(false),
+    failed_(false),
+    stop_(false)
+{
+    //aligned_alloc wants the size to be a multiple of the alignment
+    const size_t allocation = (buffer_size_ + BUFFER_ALIGNMENT - 1) / BUFFER_ALIGNMENT * BUFFER_ALIGNMENT;
+
+    for (auto &buffer : buffers_)
+    {
+        buffer.data = static_cast<char *>(aligned_alloc(BUFFER_ALIGNMENT, allocation));
+        buffer.size = 0;
+
+        if (buffer.data == nullptr)
+        {
+            throw bad_alloc();
+        }
+    }
+}
+
+ReadAheadReader::~ReadAheadReader()
+{
+    close();
+
+    for (auto &buffer : buffers_)
+    {
+        free(buffer.data);
+    }
+}
+
+bool ReadAheadReader::open(const string &filename)
+{
+    close();
+
+    const bool is_stdin = (filename == "-");
+    const int fd = is_stdin ? STDIN_FILENO : ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    source_ = OpenByteSource(fd, !is_stdin);
+
+    if (!source_)
+    {
+        return false;
+    }
+
+    produced_ = 0;
+    consumed_ = 0;
+    eof_ = false;
+    failed_ = false;
+    stop_ = false;
+
+    thread_ = thread(&ReadAheadReader::readLoop, this);
+
+    return true;
+}
+
+void ReadAheadReader::close()
+{
+    if (thread_.joinable())
+    {
+        stop_.store(true, memory_order_release);
+        thread_.join();
+    }
+
+    source_.reset();
+}
+
+bool ReadAheadReader::next(string_view &block)
+{
+    const uint64_t consumed = consumed_.load(memory_order_relaxed);
+    bool finished = false;
+
+    WaitFor([&]
+    {
+        if (consumed < produced_.load(memory_order_acquire))
+        {
+            return true;
+        }
+
+        //Producer publishes the last buffer before raising the flag
+        finished = eof_.load(memory_order_acquire) && consumed == produced_.load(memory_order_acquire);
+        return finished;
+    });
+
+    if (finished)
+    {
+        return false;
+    }
+
+    const Buffer &buffer = buffers_[consumed % BUFFER_COUNT];
+    block = string_view(buffer.data, buffer.size);
+
+    return true;
+}
+
+void ReadAheadReader::release()
+{
+    consumed_.store(consumed_.load(memory_order_relaxed) + 1, memory_order_release);
+}
+
+bool ReadAheadReader::failed() const
+{
+    return failed_.load(memory_order_acquire);
+}
+
+void ReadAheadReader::readLoop()
+{
+    for (uint64_t produced = 0; ; ++produced)
+    {
+        //Wait for the free buffer
+        WaitFor([&]
+        {
+            return stop_.load(memory_order_acquire)
+                || produced - consumed_.load(memory_order_acquire) < BUFFER_COUNT;
+        });
+
+        if (stop_.load(memory_order_acquire))
+        {
+            break;
+        }
+
+        Buffer &buffer = buffers_[produced % BUFFER_COUNT];
+        buffer.size = 0;
+
+        bool end = false;
+
+        //Fill the whole buffer, pipes return the data in small portions
+        while (buffer.size < buffer_size_)
+        {
+            const ssize_t result = source_->read(buffer.data + buffer.size, buffer_size_ - buffer.size);
+
+            if (result > 0)
+            {
+                buffer.size += static_cast<size_t>(result);
+            }
+            else
+            {
+                if (result < 0)
+                {
+                    failed_.store(true, memory_order_release);
+                }
+
+                end = true;
+                break;
+            }
+        }
+
+        if (buffer.size > 0)
+        {
+            produced_.store(produced + 1, memory_order_release);
+        }
+
+        if (end)
+        {
+            break;
+        }
+    }
+
+    eof_.store(true, memory_order_release);
+}
@@ -0,0 +1,198 @@
+//
+//  read_ahead.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 09.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef read_ahead_hpp
+#define read_ahead_hpp
+
+//System includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+//Local includes
+#include "defines.h"
+#include "tokenizer.hpp"
+#include "delimiter_scanner.hpp"
+#include "byte_source.hpp"
+
+namespace md
+{
+namespace readers
+{
+
+using namespace std;
+
+/**
+ * Reads the input which can't be mapped (pipes, stdin, network file systems)
+ * on the separate thread. Large page aligned buffers are filled ahead of the
+ * consumer and handed over through the single producer single consumer ring,
+ * so the parsing and the book updates overlap with the I/O. Compressed inputs
+ * are detected from the magic bytes and decoded on the reading thread too.
+ */
+class ReadAheadReader
+{
+public:
+    /** Default size of one buffer in bytes */
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+    /** Number of the buffers in the ring */
+    static constexpr size_t BUFFER_COUNT = 4;
+
+    /**
+     * Constructor
+     * @param buffer_size size of one buffer in bytes
+     */
+    explicit ReadAheadReader(size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /** Destructor. Stops the reading thread */
+    ~ReadAheadReader();
+
+    /**
+     * Is used to open the input and start the reading thread. First bytes of
+     * the input are read to detect the compression
+     * @param filename path to the file. "-" stands for the standard input
+     * @return true if the input was opened, false otherwise
+     */
+    bool open(const string &filename);
+
+    /** Stops the reading thread and closes the input */
+    void close();
+
+    /**
+     * Is used to get the next filled buffer. Blocks until it is available
+     * @param block where to store the content of the buffer
+     * @return false once the whole input was consumed
+     */
+    bool next(string_view &block);
+
+    /** Gives the buffer returned by next() back to the reading thread */
+    void release();
+
+    /**
+     * Is used to check whether or not the input was read without errors
+     * @return true if reading failed
+     */
+    bool failed() const;
+
+    /**
+     * Is used to feed every non empty line of the input to the handler. Lines
+     * are split on '\n' exactly as getline does it
+     * @param handler callable (string_view line, const TokenList &tokens)
+     */
+    template <typename Handler>
+    void forEachLine(Handler handler);
+
+private:
+    /** Reading thread routine */
+    void readLoop();
+
+    /** One buffer of the ring */
+    struct Buffer
+    {
+        /** Page aligned memory of buffer_size_ bytes */
+        char *data;
+
+        /** Number of the bytes filled */
+        size_t size;
+    };
+
+    /** Input. Decompresses it if needed */
+    unique_ptr<ByteSource> source_;
+
+    /** Size of one buffer in bytes */
+    size_t buffer_size_;
+
+    /** Buffers ring */
+    Buffer buffers_[BUFFER_COUNT];
+
+    /** Number of the buffers filled by the reading thread */
+    atomic<uint64_t> produced_;
+
+    /** Number of the buffers released by the consumer */
+    atomic<uint64_t> consumed_;
+
+    /** Is set once the reading thread hit the end of the input */
+    atomic<bool> eof_;
+
+    /** Is set if the read failed */
+    atomic<bool> failed_;
+
+    /** Asks the reading thread to stop */
+    atomic<bool> stop_;
+
+    /** Reading thread */
+    thread thread_;
+
+    PREVENT_COPY(ReadAheadReader);
+    PREVENT_MOVE(ReadAheadReader);
+};
+
+/**************************** Implementation **************************/
+
+template <typename Handler>
+void ReadAheadReader::forEachLine(Handler handler)
+{
+    md::tokenizers::BlockTokenizer tokenizer;
+    md::tokenizers::TokenList tokens;
+
+    //Beginning of the line which continues in the next buffer
+    string carry;
+
+    auto flush_carry = [&]()
+    {
+        if (!carry.empty())
+        {
+            md::tokenizers::Tokenize(carry, ',', tokens);
+            handler(string_view(carry), static_cast<const md::tokenizers::TokenList &>(tokens));
+            carry.clear();
+        }
+    };
+
+    for (string_view block; next(block); release())
+    {
+        if (!carry.empty())
+        {
+            const void *newline = memchr(block.data(), '\n', block.size());
+
+            if (newline == nullptr)
+            {
+                carry.append(block);
+                continue;
+            }
+
+            const size_t length = static_cast<const char *>(newline) - block.data();
+            carry.append(block.data(), length);
+            flush_carry();
+
+            block.remove_prefix(length + 1);
+        }
+
+        const size_t last = block.rfind('\n');
+
+        if (last == string_view::npos)
+        {
+            carry.assign(block);
+            continue;
+        }
+
+        tokenizer.forEachLine(block.substr(0, last + 1), handler);
+        carry.assign(block.substr(last + 1));
+    }
+
+    flush_carry();
+}
+
+} // namespace readers
+} // namespace md
+
+#endif /* read_ahead_hpp */
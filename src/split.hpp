@@ -45,7 +45,7 @@ void split(const string &s, char delim, Out result)
  * @param delim delimiter to be used
  * @return vector of tokens
  */
-vector<string> split(const string &s, char delim)
+inline vector<string> split(const string &s, char delim)
 {
     vector<string> elems;
     split(s, delim, back_inserter(elems));
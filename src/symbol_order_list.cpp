@@ -10,7 +10,7 @@
 
 //System includes
 #include <iostream>
-#include <cstdlib>
+#include <sstream>
 #include <algorithm>
 
 //Local includes
@@ -24,103 +24,118 @@ namespace
 {
 
 /**
- * Is used to check the order for validity. Throws OrderProcessException
- * if something is wrong
- * @param order_id order unique identificator
+ * Is used to check the order for validity
  * @param side "Buy" or "Sell"
  * @param quantity number of shares
  * @param price for one share
+ * @return ORDER_OK if the order is valid, the reason otherwise
  */
-void OrderCheckAssertion(const uint64_t order_id,
-                         const OrderSide side,
-                         const uint64_t quantity,
-                         const double price)
+OrderStatus OrderCheck(const OrderSide side,
+                       const uint64_t quantity,
+                       const Price price)
 {
     if (quantity == 0)
     {
-        throw OrderProcessException("For order_id [" + to_string(order_id)
-            + "] quantity is zero");
+        return ORDER_ZERO_QUANTITY;
     }
 
     if (price < 0)
     {
-        throw OrderProcessException("For order_id [" + to_string(order_id)
-            + "] price is negative");
+        return ORDER_NEGATIVE_PRICE;
     }
 
     if (side == OrderSide::UNKNOWN)
     {
-        throw OrderProcessException("For order_id [" + to_string(order_id)
-            + "] side is unknown");
+        return ORDER_UNKNOWN_SIDE;
     }
+
+    return ORDER_OK;
 }
 
 /**
- * Is used to collect the bbo information through out the range
- * @param range pair of iterators of the range of interest
- * @param bbo_volume reference to return back the total volume
- * @param bbo_price reference to return back the price level
- * @param orders_in_range reference to return back the number of orders on this price level
+ * Is used to check whether or not the modified order keeps its place in the queue
+ * @param priority rules to use
+ * @param old_quantity number of shares before the modify
+ * @param new_quantity number of shares after the modify
+ * @return true if the place is kept
  */
-void PutTogetherBbo(const pair<multiset<OrderRequest>::iterator, multiset<OrderRequest>::iterator> &range,
-                    uint64_t &bbo_volume,
-                    double &bbo_price,
-                    uint32_t &orders_in_range)
+bool KeepsPriority(ModifyPriority priority, uint64_t old_quantity, uint64_t new_quantity)
 {
-    bbo_volume = 0;
-    bbo_price = 0;
-    orders_in_range = 0;
-
-    for_each(range.first, range.second,
-        [&bbo_volume](const OrderRequest& obj){ bbo_volume += obj.quantity; });
-
-    bbo_price = range.first->price;
+    switch (priority)
+    {
+        case MODIFY_KEEP_ON_SIZE_DOWN:
+            return new_quantity <= old_quantity;
+        case MODIFY_KEEP_ON_SAME_PRICE:
+            return true;
+        default:
+            return false;
+    }
+}
 
-    orders_in_range = distance(range.first, range.second);
+/**
+ * Is used to throw OrderProcessException if the status is not ORDER_OK
+ * @param status of the operation
+ * @param order_id order unique identificator
+ */
+void ThrowOnFailure(OrderStatus status, uint64_t order_id)
+{
+    if (status != ORDER_OK)
+    {
+        throw OrderProcessException(OrderStatusMessage(status, order_id));
+    }
 }
 
 /**
  * Is used to calculate the vwap information on the requested quantity
- * @param begin multiset iterator to the begining of the range of interest
- * @param end multiset iterator to the end of the range of interest
+ * @param book side of the book
  * @param requested_quantity numbeer of shares to calculate vwap for
- * @return vwap information
+ * @return vwap information in ticks
  */
-double CalculateVwap(multiset<OrderRequest>::iterator begin,
-                     multiset<OrderRequest>::iterator end,
-                     const uint64_t &requested_quantity)
+template <typename Book>
+double CalculateVwap(Book &book, const uint64_t &requested_quantity)
 {
-    double total_price_over_quantity = 0.0;
-    int64_t left_quantity = requested_quantity;
+    //Products of ticks and quantities are integers, exact in double up to 2^53
+    return static_cast<double>(book.depthNotional(requested_quantity)) / requested_quantity;
+}
 
-    for(auto itr = begin; itr != end; ++itr)
+} // namespace
+
+/***************************** OrderStatus ****************************/
+
+ostream & WriteOrderStatus(ostream &out, OrderStatus status, uint64_t order_id)
+{
+    switch (status)
     {
-        left_quantity -= itr->quantity;
-
-        if(left_quantity > 0)
-        {
-            total_price_over_quantity += itr->price * itr->quantity;
-        }
-        else
-        {
-            total_price_over_quantity += itr->price * (itr->quantity - llabs(left_quantity));
-
-            // We covered all the requested quantity
-            break;
-        }
+        case ORDER_OK:
+            return out << "Success for order_id [" << order_id << "]";
+        case ORDER_ZERO_QUANTITY:
+            return out << "For order_id [" << order_id << "] quantity is zero";
+        case ORDER_NEGATIVE_PRICE:
+            return out << "For order_id [" << order_id << "] price is negative";
+        case ORDER_UNKNOWN_SIDE:
+            return out << "For order_id [" << order_id << "] side is unknown";
+        case ORDER_DUPLICATED:
+            return out << "Dublicated order_id [" << order_id << "]";
+        case ORDER_NOT_FOUND:
+            return out << "No such order_id [" << order_id << "]";
     }
 
-    return total_price_over_quantity / requested_quantity;
+    return out << "Unknown status for order_id [" << order_id << "]";
 }
 
-} // namespace
+string OrderStatusMessage(OrderStatus status, uint64_t order_id)
+{
+    stringstream out;
+    WriteOrderStatus(out, status, order_id);
+    return out.str();
+}
 
 /*************************** SymbolOrderList **************************/
 
 SymbolOrderList::SymbolOrderList(string symbol) :
-    orders_buy_(make_shared<multiset<OrderRequest, greater<OrderRequest>>>()),
-    orders_sell_(make_shared<multiset<OrderRequest, less<OrderRequest>>>()),
     total_quantity_(0),
+    modify_priority_(MODIFY_REQUEUE),
+    bbo_changed_(false),
     symbol_(symbol)
 {
 }
@@ -135,118 +150,245 @@ const string & SymbolOrderList::symbol()
     return symbol_;
 }
 
-void SymbolOrderList::add(uint64_t order_id, OrderSide side, uint64_t quantity, double price)
+void SymbolOrderList::setModifyPriority(ModifyPriority priority)
+{
+    modify_priority_ = priority;
+}
+
+ModifyPriority SymbolOrderList::getModifyPriority() const
 {
-    OrderCheckAssertion(order_id, side, quantity, price);
+    return modify_priority_;
+}
 
-    auto search = existing_orders_.find(order_id);
+void SymbolOrderList::add(uint64_t order_id, OrderSide side, uint64_t quantity, Price price)
+{
+    ThrowOnFailure(tryAdd(order_id, side, quantity, price), order_id);
+}
 
-    if (search != existing_orders_.end())
+OrderStatus SymbolOrderList::tryAdd(uint64_t order_id, OrderSide side, uint64_t quantity, Price price)
+{
+    const OrderStatus status = OrderCheck(side, quantity, price);
+
+    if (status != ORDER_OK)
     {
-        throw OrderProcessException("Dublicated order_id [" + to_string(order_id)
-            + "]");
+        return status;
     }
 
-    multiset<OrderRequest>::iterator itr;
+    auto added = existing_orders_.tryEmplace(order_id);
 
-    if (side == OrderSide::BUY)
+    if (!added.second)
     {
-        itr = orders_buy_->insert({order_id, quantity, price});
+        return ORDER_DUPLICATED;
     }
-    else if (side == OrderSide::SELL)
+
+    *added.first = {side, insertOrder(order_id, side, quantity, price)};
+    refreshBbo(side);
+
+    return ORDER_OK;
+}
+
+OrderStatus SymbolOrderList::tryAdd(uint64_t order_id, OrderSide side, uint64_t quantity, Price price,
+                                    OrderHandle &handle)
+{
+    const OrderStatus status = OrderCheck(side, quantity, price);
+
+    if (status != ORDER_OK)
     {
-        itr = orders_sell_->insert({order_id, quantity, price});
+        return status;
     }
 
-    existing_orders_.insert({ order_id, {side, itr} });
+    handle.order = insertOrder(order_id, side, quantity, price);
+    handle.side = side;
+    refreshBbo(side);
 
-    total_quantity_+=quantity;
+    return ORDER_OK;
 }
 
-void SymbolOrderList::modify(uint64_t order_id, uint64_t quantity, double price)
+void SymbolOrderList::modify(uint64_t order_id, uint64_t quantity, Price price)
 {
-    //To prevent from throwing - feed dummy side to the assertion
-    OrderCheckAssertion(order_id, OrderSide::BUY, quantity, price);
+    ThrowOnFailure(tryModify(order_id, quantity, price), order_id);
+}
 
-    auto search = existing_orders_.find(order_id);
+OrderStatus SymbolOrderList::tryModify(uint64_t order_id, uint64_t quantity, Price price)
+{
+    //Side is not changed by modify - feed dummy side to the check
+    const OrderStatus status = OrderCheck(OrderSide::BUY, quantity, price);
 
-    if (search == existing_orders_.end())
+    if (status != ORDER_OK)
     {
-        throw OrderProcessException("No such order_id [" + to_string(order_id)
-            + "]");
+        return status;
     }
 
-    total_quantity_ -= search->second.second->quantity;
+    auto search = existing_orders_.find(order_id);
 
-    if (search->second.first == OrderSide::BUY)
+    if (search == nullptr)
     {
-        orders_buy_->erase(search->second.second);
-        search->second.second = orders_buy_->insert({order_id, quantity, price});
+        return ORDER_NOT_FOUND;
     }
-    else if (search->second.first == OrderSide::SELL)
+
+    search->second = modifyOrder(search->first, search->second, quantity, price);
+    refreshBbo(search->first);
+
+    return ORDER_OK;
+}
+
+OrderStatus SymbolOrderList::tryModify(OrderHandle &handle, uint64_t quantity, Price price)
+{
+    //Side is not changed by modify - feed dummy side to the check
+    const OrderStatus status = OrderCheck(OrderSide::BUY, quantity, price);
+
+    if (status != ORDER_OK)
     {
-        orders_sell_->erase(search->second.second);
-        search->second.second = orders_sell_->insert({order_id, quantity, price});
+        return status;
     }
 
-    total_quantity_ += quantity;
+    handle.order = modifyOrder(handle.side, handle.order, quantity, price);
+    refreshBbo(handle.side);
+
+    return ORDER_OK;
 }
 
 void SymbolOrderList::cancel(uint64_t order_id)
+{
+    ThrowOnFailure(tryCancel(order_id), order_id);
+}
+
+OrderStatus SymbolOrderList::tryCancel(uint64_t order_id)
 {
     auto search = existing_orders_.find(order_id);
 
-    if (search == existing_orders_.end())
+    if (search == nullptr)
     {
-        throw OrderProcessException("No such order_id [" + to_string(order_id)
-            + "]");
+        return ORDER_NOT_FOUND;
     }
 
-    total_quantity_ -= search->second.second->quantity;
+    eraseOrder(search->first, search->second);
+    refreshBbo(search->first);
+    existing_orders_.erase(order_id);
+
+    return ORDER_OK;
+}
+
+void SymbolOrderList::cancel(const OrderHandle &handle)
+{
+    eraseOrder(handle.side, handle.order);
+    refreshBbo(handle.side);
+}
+
+OrderRequest SymbolOrderList::order(OrderSide side, OrderRef order) const
+{
+    return side == OrderSide::BUY ? orders_buy_.orders().request(order) : orders_sell_.orders().request(order);
+}
+
+const OrderNode & SymbolOrderList::orderNode(OrderSide side, OrderRef order) const
+{
+    return side == OrderSide::BUY ? orders_buy_.orders().node(order) : orders_sell_.orders().node(order);
+}
 
-    if (search->second.first == OrderSide::BUY)
+OrderRef SymbolOrderList::insertOrder(uint64_t order_id, OrderSide side, uint64_t quantity, Price price)
+{
+    OrderRef order = NO_ORDER;
+
+    if (side == OrderSide::BUY)
     {
-        orders_buy_->erase(search->second.second);
+        order = orders_buy_.insert(order_id, quantity, price);
     }
-    else if (search->second.first == OrderSide::SELL)
+    else if (side == OrderSide::SELL)
     {
-        orders_sell_->erase(search->second.second);
+        order = orders_sell_.insert(order_id, quantity, price);
     }
 
-    existing_orders_.erase(search);
+    total_quantity_ += quantity;
+
+    return order;
 }
 
-OrderBbo SymbolOrderList::bbo()
+void SymbolOrderList::eraseOrder(OrderSide side, OrderRef order)
 {
-    OrderBbo result;
+    total_quantity_ -= orderNode(side, order).quantity;
 
-    uint64_t bbo_volume = 0;
-    double bbo_price = 0;
-    uint32_t orders_in_range = 0;
+    if (side == OrderSide::BUY)
+    {
+        orders_buy_.erase(order);
+    }
+    else if (side == OrderSide::SELL)
+    {
+        orders_sell_.erase(order);
+    }
+}
+
+OrderRef SymbolOrderList::modifyOrder(OrderSide side, OrderRef order, uint64_t quantity, Price price)
+{
+    const OrderNode &node = orderNode(side, order);
 
-    if (!orders_buy_->empty())
+    if (node.price != price)
     {
-        auto buy_range = orders_buy_->equal_range(*(orders_buy_->begin()));
-        PutTogetherBbo(buy_range, bbo_volume, bbo_price, orders_in_range);
+        const uint64_t order_id = this->order(side, order).order_id;
 
-        result.setBuyTotalVolume(bbo_volume);
-        result.setBuySharePrice(bbo_price);
-        result.setBuyOrderCount(orders_in_range);
-        result.setBuyNil(false);
+        eraseOrder(side, order);
+        return insertOrder(order_id, side, quantity, price);
     }
 
-    if (!orders_sell_->empty())
+    const bool keep_priority = KeepsPriority(modify_priority_, node.quantity, quantity);
+
+    total_quantity_ = total_quantity_ - node.quantity + quantity;
+
+    if (side == OrderSide::BUY)
     {
-        auto sell_range = orders_sell_->equal_range(*(orders_sell_->begin()));
-        PutTogetherBbo(sell_range, bbo_volume, bbo_price, orders_in_range);
+        orders_buy_.amend(order, quantity, keep_priority);
+    }
+    else if (side == OrderSide::SELL)
+    {
+        orders_sell_.amend(order, quantity, keep_priority);
+    }
 
-        result.setSellTotalVolume(bbo_volume);
-        result.setSellSharePrice(bbo_price);
-        result.setSellOrderCount(orders_in_range);
-        result.setSellNil(false);
+    return order;
+}
+
+void SymbolOrderList::refreshBbo(OrderSide side)
+{
+    const OrderBbo previous = bbo_;
+
+    if (side == OrderSide::BUY)
+    {
+        const bool nil = orders_buy_.empty();
+        const PriceLevel best = nil ? PriceLevel{} : orders_buy_.best();
+
+        bbo_.setBuyTotalVolume(best.total_quantity);
+        bbo_.setBuySharePrice(best.price);
+        bbo_.setBuyOrderCount(best.order_count);
+        bbo_.setBuyNil(nil);
+    }
+    else if (side == OrderSide::SELL)
+    {
+        const bool nil = orders_sell_.empty();
+        const PriceLevel best = nil ? PriceLevel{} : orders_sell_.best();
+
+        bbo_.setSellTotalVolume(best.total_quantity);
+        bbo_.setSellSharePrice(best.price);
+        bbo_.setSellOrderCount(best.order_count);
+        bbo_.setSellNil(nil);
+    }
+
+    if (bbo_ != previous)
+    {
+        bbo_changed_ = true;
     }
+}
+
+const OrderBbo & SymbolOrderList::bbo() const
+{
+    return bbo_;
+}
+
+bool SymbolOrderList::bboChanged() const
+{
+    return bbo_changed_;
+}
 
-    return result;
+void SymbolOrderList::resetBboChanged()
+{
+    bbo_changed_ = false;
 }
 
 OrderVwap SymbolOrderList::vwap(uint64_t quantity)
@@ -263,14 +405,14 @@ OrderVwap SymbolOrderList::vwap(uint64_t quantity)
 
     double buy_vwap = 0, sell_vwap = 0;
 
-    if (!orders_buy_->empty())
+    if (!orders_buy_.empty())
     {
-        buy_vwap = CalculateVwap(orders_buy_->begin(), orders_buy_->end(), quantity);
+        buy_vwap = CalculateVwap(orders_buy_, quantity);
     }
 
-    if (!orders_sell_->empty())
+    if (!orders_sell_.empty())
     {
-        sell_vwap = CalculateVwap(orders_sell_->begin(), orders_sell_->end(), quantity);
+        sell_vwap = CalculateVwap(orders_sell_, quantity);
     }
 
     return {buy_vwap, sell_vwap};
@@ -280,3 +422,13 @@ OrderIterator SymbolOrderList::getIterator()
 {
     return OrderIterator(orders_buy_, orders_sell_);
 }
+
+const BidBook & SymbolOrderList::bids() const
+{
+    return orders_buy_;
+}
+
+const AskBook & SymbolOrderList::asks() const
+{
+    return orders_sell_;
+}
@@ -11,19 +11,22 @@
 #define _SYMBOLORDERLIST_H
 
 //System includes
+#include <ostream>
 #include <set>
 #include <string>
 
 //Local includes
 #include "defines.h"
 #include "container_definitions.hpp"
+#include "order_bbo.hpp"
+#include "price_ladder_book.hpp"
+#include "price.hpp"
 
 using namespace std;
 
 //Forward declarations
 struct OrderRequest;
 struct OrderVwap;
-class OrderBbo;
 class OrderIterator;
 
 /**
@@ -74,6 +77,53 @@ protected:
     string msg_;
 };
 
+/**
+ * Result of the order operation. Is returned by the non throwing
+ * SymbolOrderList methods, so the rejected orders cost no allocations
+ */
+enum OrderStatus
+{
+    ORDER_OK,
+    ORDER_ZERO_QUANTITY,
+    ORDER_NEGATIVE_PRICE,
+    ORDER_UNKNOWN_SIDE,
+    ORDER_DUPLICATED,
+    ORDER_NOT_FOUND
+};
+
+/**
+ * Rules for the place of the modified order in its price level queue.
+ * Price change always puts the order at the end of the new level
+ */
+enum ModifyPriority
+{
+    /** Every modify puts the order at the end of its level */
+    MODIFY_REQUEUE,
+
+    /** Quantity decrease keeps the place of the order, increase loses it */
+    MODIFY_KEEP_ON_SIZE_DOWN,
+
+    /** Any quantity change keeps the place of the order */
+    MODIFY_KEEP_ON_SAME_PRICE
+};
+
+/**
+ * Is used to write the description of the order status
+ * @param out where to write
+ * @param status of the operation
+ * @param order_id order unique identificator
+ * @return modified out stream
+ */
+ostream & WriteOrderStatus(ostream &out, OrderStatus status, uint64_t order_id);
+
+/**
+ * Is used to get the description of the order status
+ * @param status of the operation
+ * @param order_id order unique identificator
+ * @return description. Same text as OrderProcessException carries
+ */
+string OrderStatusMessage(OrderStatus status, uint64_t order_id);
+
 /**
  * Order List class. Only orders for specific symbol are held.
  * Automatically updates the BBO information upon the order
@@ -103,37 +153,116 @@ public:
      */
     const string & symbol();
 
+    /**
+     * Is used to set the rules for the place of the modified orders in the queue
+     * @param priority rules to use. MODIFY_REQUEUE by default
+     */
+    void setModifyPriority(ModifyPriority priority);
+
+    /**
+     * Is used to get the rules for the place of the modified orders in the queue
+     * @return rules in use
+     */
+    ModifyPriority getModifyPriority() const;
+
     /**
      * Is used to add a valid order to this object. BBO will be
-     * recalculated in this case
+     * recalculated in this case. Throws OrderProcessException on failure
+     * @param order_id order unique identificator
+     * @param side "Buy" or "Sell"
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     */
+    void add(uint64_t order_id, OrderSide side, uint64_t quantity, Price price);
+
+    /**
+     * Same as above, but does not throw
      * @param order_id order unique identificator
      * @param side "Buy" or "Sell"
      * @param quantity number of shares
-     * @param price for one share
+     * @param price for one share in ticks
+     * @return ORDER_OK if the order was added, the reason otherwise
      */
-    void add(uint64_t order_id, OrderSide side, uint64_t quantity, double price);
+    OrderStatus tryAdd(uint64_t order_id, OrderSide side, uint64_t quantity, Price price);
 
     /**
-     * Is used to modify the existing order in this object.
-     * BBO will be recalculated in this case
+     * Same as above, but the order is not put in to the id map of this object.
+     * Duplicates are not detected, the caller keeps the index of the order ids
      * @param order_id order unique identificator
+     * @param side "Buy" or "Sell"
      * @param quantity number of shares
-     * @param price for one share
+     * @param price for one share in ticks
+     * @param handle where to store the side and the reference of the order.
+     *               The symbol is left as is
+     * @return ORDER_OK if the order was added, the reason otherwise
      */
-    void modify(uint64_t order_id, uint64_t quantity, double price);
+    OrderStatus tryAdd(uint64_t order_id, OrderSide side, uint64_t quantity, Price price, OrderHandle &handle);
 
     /**
-     * Is used to cancel the existing order in this object.
-     * BBO will be recalculated in this case
+     * Is used to modify the existing order in this object. BBO will be
+     * recalculated in this case. If the price is the same, the order is
+     * changed in place and its place in the queue follows ModifyPriority.
+     * Throws OrderProcessException on failure
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     */
+    void modify(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Same as above, but does not throw
+     * @param order_id order unique identificator
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return ORDER_OK if the order was modified, the reason otherwise
+     */
+    OrderStatus tryModify(uint64_t order_id, uint64_t quantity, Price price);
+
+    /**
+     * Is used to modify the order added with the handle
+     * @param handle of the order. The reference is updated
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return ORDER_OK if the order was modified, the reason otherwise
+     */
+    OrderStatus tryModify(OrderHandle &handle, uint64_t quantity, Price price);
+
+    /**
+     * Is used to cancel the existing order in this object. BBO will be
+     * recalculated in this case. Throws OrderProcessException on failure
      * @param order_id order unique identificator
      */
     void cancel(uint64_t order_id);
 
     /**
-     * Is used to get the current Best Bid Offer (BBO)
+     * Same as above, but does not throw
+     * @param order_id order unique identificator
+     * @return ORDER_OK if the order was canceled, the reason otherwise
+     */
+    OrderStatus tryCancel(uint64_t order_id);
+
+    /**
+     * Is used to cancel the order added with the handle
+     * @param handle of the order. Is not valid anymore after the call
+     */
+    void cancel(const OrderHandle &handle);
+
+    /**
+     * Is used to get the current Best Bid Offer (BBO). Is kept up to date
+     * by every add, modify and cancel, so nothing is calculated here
      * @return object with current BBO
      */
-    OrderBbo bbo();
+    const OrderBbo & bbo() const;
+
+    /**
+     * Is used to check whether or not the BBO was changed by any add, modify
+     * or cancel since the last resetBboChanged call
+     * @return true if changed
+     */
+    bool bboChanged() const;
+
+    /** Is used to mark the current BBO as seen */
+    void resetBboChanged();
 
     /**
      * Is used to get the current Volume Weighted Average Price (VWAP)
@@ -148,19 +277,89 @@ public:
      */
     OrderIterator getIterator();
 
+    /**
+     * Is used to get the order
+     * @param side "Buy" or "Sell"
+     * @param order reference to the order in the book of the side
+     * @return id, quantity and price of the order
+     */
+    OrderRequest order(OrderSide side, OrderRef order) const;
+
+    /**
+     * Is used to get the price levels of the "Buy" side
+     * @return bid levels from the highest price
+     */
+    const BidBook & bids() const;
+
+    /**
+     * Is used to get the price levels of the "Sell" side
+     * @return ask levels from the lowest price
+     */
+    const AskBook & asks() const;
+
 protected:
-    /** Holds the buy offers sorted by the price top to down */
-    OrderSetGreaterPtr orders_buy_;
+    /**
+     * Is used to put the valid order in to the book of its side
+     * @param order_id order unique identificator
+     * @param side "Buy" or "Sell"
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return reference to the order
+     */
+    OrderRef insertOrder(uint64_t order_id, OrderSide side, uint64_t quantity, Price price);
+
+    /**
+     * Is used to remove the order from the book of its side
+     * @param side "Buy" or "Sell"
+     * @param order reference to the order
+     */
+    void eraseOrder(OrderSide side, OrderRef order);
 
-    /** Holds the sell offers sorted by the price down to top */
-    OrderSetLessPtr orders_sell_;
+    /**
+     * Is used to change the valid order. Same price orders are changed in place
+     * @param side "Buy" or "Sell"
+     * @param order reference to the order
+     * @param quantity number of shares
+     * @param price for one share in ticks
+     * @return reference to the order. Is the same one if the price was not changed
+     */
+    OrderRef modifyOrder(OrderSide side, OrderRef order, uint64_t quantity, Price price);
 
-    /** Holds the existing orders in this object */
+    /**
+     * Is used to get the book part of the order
+     * @param side "Buy" or "Sell"
+     * @param order reference to the order
+     * @return node of the order
+     */
+    const OrderNode & orderNode(OrderSide side, OrderRef order) const;
+
+    /**
+     * Is used to update the cached BBO of the side after its book was changed
+     * @param side "Buy" or "Sell"
+     */
+    void refreshBbo(OrderSide side);
+
+    /** Holds the buy offers by price level top to down */
+    BidBook orders_buy_;
+
+    /** Holds the sell offers by price level down to top */
+    AskBook orders_sell_;
+
+    /** Holds the existing orders added by id. Orders added with the handles are not here */
     OrderIdMap existing_orders_;
 
     /** Holds the total amount of shares in this object */
     uint64_t total_quantity_;
 
+    /** Holds the rules for the place of the modified orders */
+    ModifyPriority modify_priority_;
+
+    /** Holds the current BBO */
+    OrderBbo bbo_;
+
+    /** Whether or not the BBO was changed since it was last marked as seen */
+    bool bbo_changed_;
+
 private:
     /** Holds the symbol associated with this object */
     const string symbol_;
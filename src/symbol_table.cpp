@@ -0,0 +1,88 @@
+//
+//  symbol_table.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 12.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#include "symbol_table.hpp"
+
+//System includes
+#include <cstring>
+
+//Local includes
+
+/*************************** Helper Functions *************************/
+
+namespace
+{
+
+/**
+ * Is used to pack the short symbol in to the single key. Length goes to the
+ * top byte, so the symbols which differ only by the trailing zero bytes
+ * still get different keys
+ * @param symbol of up to SymbolTable::PACKED_SIZE bytes
+ * @return packed key
+ */
+inline uint64_t PackSymbol(string_view symbol)
+{
+    uint64_t key = 0;
+    memcpy(&key, symbol.data(), symbol.size());
+    return key | (static_cast<uint64_t>(symbol.size()) << 56);
+}
+
+} // namespace
+
+/**************************** Implementation **************************/
+
+SymbolId SymbolTable::intern(string_view symbol)
+{
+    const SymbolId next = static_cast<SymbolId>(names_.size());
+
+    if (symbol.size() <= PACKED_SIZE)
+    {
+        auto added = packed_.insert({PackSymbol(symbol), next});
+
+        if (added.second)
+        {
+            names_.emplace_back(symbol);
+        }
+
+        return added.first->second;
+    }
+
+    auto search = long_.find(symbol);
+
+    if (search != long_.end())
+    {
+        return search->second;
+    }
+
+    names_.emplace_back(symbol);
+    long_.insert({string_view(names_.back()), next});
+
+    return next;
+}
+
+SymbolId SymbolTable::find(string_view symbol) const
+{
+    if (symbol.size() <= PACKED_SIZE)
+    {
+        auto search = packed_.find(PackSymbol(symbol));
+        return search != packed_.end() ? search->second : INVALID_SYMBOL_ID;
+    }
+
+    auto search = long_.find(symbol);
+    return search != long_.end() ? search->second : INVALID_SYMBOL_ID;
+}
+
+const string & SymbolTable::name(SymbolId id) const
+{
+    return names_[id];
+}
+
+size_t SymbolTable::size() const
+{
+    return names_.size();
+}
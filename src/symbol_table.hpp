@@ -0,0 +1,90 @@
+//
+//  symbol_table.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 12.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef symbol_table_hpp
+#define symbol_table_hpp
+
+//System includes
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+//Local includes
+#include "defines.h"
+
+using namespace std;
+
+/** Dense identificator of the interned symbol */
+using SymbolId = uint32_t;
+
+/** Is returned when the symbol is not in the table */
+const SymbolId INVALID_SYMBOL_ID = numeric_limits<SymbolId>::max();
+
+/**
+ * Symbol table. Every symbol is stored once and gets the id which is the
+ * index of the symbol in the order of interning, so the per symbol data can
+ * be kept in the vectors. Symbols of up to PACKED_SIZE bytes, which is almost
+ * every ticker, are looked up by the 8 byte key with no string hashing
+ */
+class SymbolTable final
+{
+public:
+    /** Longest symbol which is packed in to the 8 byte key */
+    static constexpr size_t PACKED_SIZE = 7;
+
+    /** Default constructor */
+    SymbolTable() = default;
+
+    /** Default destructor */
+    ~SymbolTable() = default;
+
+    /**
+     * Is used to get the id of the symbol. Adds the symbol if it is new
+     * @param symbol to look up
+     * @return id of the symbol
+     */
+    SymbolId intern(string_view symbol);
+
+    /**
+     * Is used to get the id of the symbol without adding it
+     * @param symbol to look up
+     * @return id of the symbol. INVALID_SYMBOL_ID if it was never interned
+     */
+    SymbolId find(string_view symbol) const;
+
+    /**
+     * Is used to get the symbol by its id
+     * @param id of the interned symbol
+     * @return the symbol
+     */
+    const string & name(SymbolId id) const;
+
+    /**
+     * Is used to get the number of the interned symbols
+     * @return number of the symbols. All the ids are below it
+     */
+    size_t size() const;
+
+private:
+    /** Short symbols by their packed key */
+    unordered_map<uint64_t, SymbolId> packed_;
+
+    /** Longer symbols. Keys point to names_ */
+    unordered_map<string_view, SymbolId> long_;
+
+    /** Symbols by id. Deque does not move them, so the views stay valid */
+    deque<string> names_;
+
+    PREVENT_COPY(SymbolTable);
+};
+
+#endif /* symbol_table_hpp */
@@ -0,0 +1,116 @@
+//
+//  tokenizer.hpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 04.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+#ifndef tokenizer_hpp
+#define tokenizer_hpp
+
+//System includes
+#include <string_view>
+#include <cstddef>
+#include <cstring>
+
+//Local includes
+
+namespace md
+{
+namespace tokenizers
+{
+
+using namespace std;
+
+/**
+ * Fixed capacity list of the tokens. Tokens are the views in to the line which
+ * was tokenized, so they are valid only while the line is alive. Nothing is
+ * allocated, the object is meant to be reused from line to line.
+ */
+class TokenList
+{
+public:
+    /** Maximal number of the tokens which are stored. Longest command has 6 */
+    static constexpr size_t CAPACITY = 8;
+
+    /** Default constructor */
+    TokenList() : size_(0) {}
+
+    /**
+     * Is used to get the number of tokens found in the line. Can be bigger than
+     * the capacity, in this case only the first CAPACITY tokens are stored
+     * @return number of tokens
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * Is used to check if there are no tokens
+     * @return true if empty
+     */
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * Is used to get the token without the bounds check
+     * @param index of the token. Must be less than min(size(), CAPACITY)
+     * @return token
+     */
+    string_view operator[](size_t index) const { return tokens_[index]; }
+
+    /** Removes all of the tokens */
+    void clear() { size_ = 0; }
+
+    /**
+     * Appends the token. Tokens above the capacity are only counted
+     * @param token to be appended
+     */
+    void push_back(string_view token)
+    {
+        if (size_ < CAPACITY)
+        {
+            tokens_[size_] = token;
+        }
+
+        ++size_;
+    }
+
+private:
+    /** Holds the tokens */
+    string_view tokens_[CAPACITY];
+
+    /** Number of tokens in the line */
+    size_t size_;
+};
+
+/**
+ * Splits the line in to the tokens by the delimiter. Empty tokens are skipped
+ * the same way the legacy split() does
+ * @param line what to be tokenized
+ * @param delim delimiter to be used
+ * @param tokens where to store the tokens. Previous content is dropped
+ */
+inline void Tokenize(string_view line, char delim, TokenList &tokens)
+{
+    tokens.clear();
+
+    const char *current = line.data();
+    const char *end = current + line.size();
+
+    while (current < end)
+    {
+        const char *found = static_cast<const char *>(memchr(current, delim, end - current));
+        const char *token_end = (found != nullptr) ? found : end;
+
+        if (token_end != current)
+        {
+            tokens.push_back(string_view(current, token_end - current));
+        }
+
+        current = token_end + 1;
+    }
+}
+
+} // namespace tokenizers
+} // namespace md
+
+#endif /* tokenizer_hpp */
@@ -9,7 +9,6 @@
 #include "vwap_subscription_data.hpp"
 
 //System includes
-#include <iostream>
 
 //Local includes
 
@@ -18,7 +17,7 @@ using namespace md::tokenizers;
 
 
 VwapSubscriptionData::VwapSubscriptionData(const string &command) :
-    symbol_(""),
+    symbol_(),
     quantity_(0),
     command_(command)
 {
@@ -42,49 +41,37 @@ VwapSubscriptionData & VwapSubscriptionData::operator=(const VwapSubscriptionDat
     return *this;
 }
 
-void VwapSubscriptionData::processTokens(const vector<string> &tokens)
+void VwapSubscriptionData::processTokens(const TokenList &tokens)
 {
-    try
+    if (tokens.size() != VwapSubscriptionIndex::SIZE)
     {
-        if (tokens.size() != VwapSubscriptionIndex::SIZE)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad number of tokens to process");
-            return;
-        }
-
-        if (tokens.at(Parent::COMMAND_NAME) != command_)
-        {
-            Parent::setProcessed(false);
-            Parent::setErrorMessage("Bad order type");
-            return;
-        }
-
-        symbol_ = tokens.at(VwapSubscriptionIndex::SYMBOL);
-
-        quantity_ = stoull(tokens.at(VwapSubscriptionIndex::QUANTITY));
-
-        Parent::setProcessed(true);
-        Parent::setErrorMessage("Success");
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad number of tokens to process");
         return;
     }
-    catch (out_of_range &e)
+
+    if (tokens[Parent::COMMAND_NAME] != command_)
     {
-        cerr << "VwapSubscriptionData::processTokens(): Out of range exception: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setProcessed(false);
+        Parent::setErrorMessage("Bad order type");
+        return;
     }
-    catch (invalid_argument &e)
+
+    symbol_ = tokens[VwapSubscriptionIndex::SYMBOL];
+
+    ParseStatus status = ParseUnsigned(tokens[VwapSubscriptionIndex::QUANTITY], quantity_);
+
+    if (status != PARSE_OK)
     {
-        cerr << "VwapSubscriptionData::processTokens(): Numeric conversion failure: ["
-            << string(e.what()) << "]" << '\n';
+        Parent::setNumericFailure("VwapSubscriptionData::processTokens()", status);
+        return;
     }
 
-    Parent::setProcessed(false);
-    Parent::setErrorMessage("Critical failure");
-    return;
+    Parent::setProcessed(true);
+    Parent::setErrorMessage("Success");
 }
 
-const string & VwapSubscriptionData::getSymbol()
+string_view VwapSubscriptionData::getSymbol()
 {
     return symbol_;
 }
@@ -10,6 +10,8 @@
 #define vwap_subscription_data_hpp
 
 //System includes
+#include <string>
+#include <string_view>
 
 //Local includes
 #include "md_command_data.hpp"
@@ -56,19 +58,19 @@ public:
 
     /**
      * Implements the operation to process all of the tokens for Vwap Subscription command
-     * @param tokens vector of the tokens for SB and UB commands
+     * @param tokens list of the tokens for SB and UB commands
      */
-    virtual void processTokens(const vector<string> &tokens) override;
+    virtual void processTokens(const TokenList &tokens) override;
 
     /** Returns current symbol */
-    const string & getSymbol();
+    string_view getSymbol();
 
     /** Returns current stock quantity */
     uint64_t getQuantity();
 
 protected:
-    /** Holds stock symbol. Can't be empty string */
-    string symbol_;
+    /** Holds stock symbol. Can't be empty string. Points in to the tokenized line */
+    string_view symbol_;
 
     /** Holds the quantity of the deal */
     uint64_t quantity_;
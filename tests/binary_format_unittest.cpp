@@ -0,0 +1,169 @@
+//
+//  binary_format_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "binary_codec.hpp"
+#include "mapped_file.hpp"
+
+using namespace std;
+using namespace md::binary;
+using md::tokenizers::Tokenize;
+
+/******************************* Helpers ******************************/
+
+/**
+ * Converts the lines in to the binary feed file
+ * @param filename where to write the feed
+ * @param lines what to convert
+ * @return number of the lines which were converted
+ */
+size_t WriteFeed(const string &filename, const vector<string> &lines)
+{
+    BinaryWriter writer;
+    EXPECT_TRUE(writer.open(filename));
+
+    TokenList tokens;
+    MdDecoder decoder;
+    BinaryRecord record;
+    size_t converted = 0;
+
+    for (const auto &line : lines)
+    {
+        Tokenize(line, ',', tokens);
+
+        if (EncodeTokens(tokens, decoder, writer, record))
+        {
+            writer.write(record);
+            ++converted;
+        }
+    }
+
+    EXPECT_TRUE(writer.close());
+    return converted;
+}
+
+/************************* BinaryFormatTestCase ***********************/
+
+TEST(BinaryFormatTestCase, RoundTripTest)
+{
+    const string filename = "binary_format_unittest.bin";
+    const vector<string> lines =
+        {
+            "ORDER ADD,1000,AAPL,Buy,10,72.82",
+            "ORDER ADD,1001,MSFT,Sell,5,0.0001",
+            "ORDER MODIFY,1000,20,72",
+            "ORDER CANCEL,1001",
+            "SUBSCRIBE BBO,AAPL",
+            "UNSUBSCRIBE BBO,AAPL",
+            "SUBSCRIBE VWAP,MSFT,100",
+            "UNSUBSCRIBE VWAP,MSFT,100",
+            "PRINT,AAPL",
+            "PRINT_FULL,GOOG"
+        };
+
+    EXPECT_EQ(WriteFeed(filename, lines), lines.size());
+
+    md::readers::MappedFile mapped;
+    ASSERT_TRUE(mapped.open(filename));
+    ASSERT_TRUE(IsBinaryFeed(mapped.view()));
+    EXPECT_EQ(mapped.view().size(),
+              sizeof(FileHeader) + lines.size() * sizeof(BinaryRecord) + 3 * sizeof(uint16_t) + 12);
+
+    BinaryFeed feed;
+    ASSERT_TRUE(feed.open(mapped.view()));
+    ASSERT_EQ(feed.size(), lines.size());
+    ASSERT_EQ(feed.symbolCount(), 3u);
+    EXPECT_EQ(feed.symbol(0), "AAPL");
+    EXPECT_EQ(feed.symbol(1), "MSFT");
+    EXPECT_EQ(feed.symbol(2), "GOOG");
+
+    const BinaryRecord add = feed.record(0);
+    EXPECT_EQ(add.command, CMD_ORDER_ADD);
+    EXPECT_EQ(add.order_id, 1000u);
+    EXPECT_EQ(add.symbol_id, 0u);
+    EXPECT_EQ(add.side, OrderSide::BUY);
+    EXPECT_EQ(add.quantity, 10u);
+    EXPECT_EQ(add.price, 728200);
+
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        EXPECT_EQ(RecordToLine(feed.record(i), feed), lines[i]);
+    }
+
+    mapped.close();
+    remove(filename.c_str());
+}
+
+TEST(BinaryFormatTestCase, CanonicalLineTest)
+{
+    const string filename = "binary_format_unittest.bin";
+
+    EXPECT_EQ(WriteFeed(filename, {"ORDER ADD,1,AAPL,Buy,1,72.80", "ORDER MODIFY,1,1,-.5"}), 2u);
+
+    md::readers::MappedFile mapped;
+    ASSERT_TRUE(mapped.open(filename));
+
+    BinaryFeed feed;
+    ASSERT_TRUE(feed.open(mapped.view()));
+    ASSERT_EQ(feed.size(), 2u);
+    EXPECT_EQ(RecordToLine(feed.record(0), feed), "ORDER ADD,1,AAPL,Buy,1,72.8");
+    EXPECT_EQ(RecordToLine(feed.record(1), feed), "ORDER MODIFY,1,1,-0.5");
+
+    mapped.close();
+    remove(filename.c_str());
+}
+
+TEST(BinaryFormatTestCase, BadLinesAreNotEncodedTest)
+{
+    const string filename = "binary_format_unittest.bin";
+    const vector<string> lines =
+        {
+            "GARBAGE",
+            ",,,",
+            "ORDER ADD,1,2",
+            "ORDER ADD,x,AAPL,Buy,1,1",
+            "ORDER ADD,1,AAPL,Hold,1,1",
+            "ORDER MODIFY,5,abc,1.0",
+            "ORDER CANCEL,",
+            "SUBSCRIBE VWAP,AAPL",
+            "PRINT"
+        };
+
+    EXPECT_EQ(WriteFeed(filename, lines), 0u);
+
+    remove(filename.c_str());
+}
+
+TEST(BinaryFormatTestCase, CorruptedFeedTest)
+{
+    const string filename = "binary_format_unittest.bin";
+
+    WriteFeed(filename, {"ORDER ADD,1000,AAPL,Buy,10,72.82", "PRINT,AAPL"});
+
+    md::readers::MappedFile mapped;
+    ASSERT_TRUE(mapped.open(filename));
+
+    const string_view data = mapped.view();
+    BinaryFeed feed;
+
+    EXPECT_FALSE(IsBinaryFeed("ORDER ADD,1000,AAPL,Buy,10,72.82"));
+    EXPECT_FALSE(feed.open("ORDER ADD,1000,AAPL,Buy,10,72.82"));
+    EXPECT_FALSE(feed.open(data.substr(0, sizeof(FileHeader) - 1)));
+    EXPECT_FALSE(feed.open(data.substr(0, sizeof(FileHeader) + sizeof(BinaryRecord))));
+    EXPECT_FALSE(feed.open(data.substr(0, data.size() - 1)));
+    EXPECT_TRUE(feed.open(data));
+
+    mapped.close();
+    remove(filename.c_str());
+}
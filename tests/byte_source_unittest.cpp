@@ -0,0 +1,160 @@
+//
+//  byte_source_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 10.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <zlib.h>
+
+#ifdef MD_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+//Local includes
+#include "byte_source.hpp"
+#include "read_ahead.hpp"
+
+using namespace std;
+using namespace md::readers;
+using md::tokenizers::TokenList;
+
+/******************************* Helpers ******************************/
+
+string MakeCompressibleFeed()
+{
+    string feed;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        feed += "ORDER ADD," + to_string(1000 + i) + ",AAPL,Buy,10,72.82\n";
+        feed += "PRINT,AAPL\n";
+    }
+
+    return feed + "ORDER CANCEL,1000";
+}
+
+string GzipMember(const string &content)
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+
+    string result(deflateBound(&stream, content.size()), '\0');
+
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(content.data()));
+    stream.avail_in = static_cast<uInt>(content.size());
+    stream.next_out = reinterpret_cast<Bytef *>(&result[0]);
+    stream.avail_out = static_cast<uInt>(result.size());
+
+    deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return result;
+}
+
+void WriteFile(const string &filename, const string &content)
+{
+    ofstream out(filename, ios::binary | ios::trunc);
+    out << content;
+}
+
+string ReadAll(const string &filename, bool &failed)
+{
+    ReadAheadReader reader(64 * 1024);
+    string result;
+
+    EXPECT_TRUE(reader.open(filename));
+
+    reader.forEachLine([&result](string_view line, const TokenList &)
+    {
+        result.append(line);
+        result += '\n';
+    });
+
+    failed = reader.failed();
+    return result;
+}
+
+/************************** ByteSourceTestCase ************************/
+
+TEST(ByteSourceTestCase, DetectCompressionTest)
+{
+    EXPECT_EQ(DetectCompression(""), COMPRESSION_NONE);
+    EXPECT_EQ(DetectCompression("ORDER ADD"), COMPRESSION_NONE);
+    EXPECT_EQ(DetectCompression("\x1f"), COMPRESSION_NONE);
+    EXPECT_EQ(DetectCompression("\x1f\x8b\x08\x00"), COMPRESSION_GZIP);
+    EXPECT_EQ(DetectCompression(string_view("\x28\xb5\x2f\xfd\x00", 5)), COMPRESSION_ZSTD);
+    EXPECT_TRUE(IsCompressionSupported(COMPRESSION_GZIP));
+}
+
+TEST(ByteSourceTestCase, GzipTest)
+{
+    const string filename = "byte_source_unittest.gz";
+    const string feed = MakeCompressibleFeed();
+    bool failed = true;
+
+    WriteFile(filename, GzipMember(feed));
+    EXPECT_EQ(ReadAll(filename, failed), feed + "\n");
+    EXPECT_FALSE(failed);
+
+    //Concatenated members, as produced by "cat a.gz b.gz"
+    WriteFile(filename, GzipMember(feed + "\n") + GzipMember(feed));
+    EXPECT_EQ(ReadAll(filename, failed), feed + "\n" + feed + "\n");
+    EXPECT_FALSE(failed);
+
+    remove(filename.c_str());
+}
+
+TEST(ByteSourceTestCase, TruncatedGzipTest)
+{
+    const string filename = "byte_source_unittest.gz";
+    const string member = GzipMember(MakeCompressibleFeed());
+    bool failed = false;
+
+    WriteFile(filename, member.substr(0, member.size() / 2));
+    ReadAll(filename, failed);
+    EXPECT_TRUE(failed);
+
+    remove(filename.c_str());
+}
+
+TEST(ByteSourceTestCase, PlainTest)
+{
+    const string filename = "byte_source_unittest.txt";
+    bool failed = true;
+
+    WriteFile(filename, "PRINT,AAPL");
+    EXPECT_EQ(ReadAll(filename, failed), "PRINT,AAPL\n");
+    EXPECT_FALSE(failed);
+
+    remove(filename.c_str());
+}
+
+#ifdef MD_HAVE_ZSTD
+
+TEST(ByteSourceTestCase, ZstdTest)
+{
+    const string filename = "byte_source_unittest.zst";
+    const string feed = MakeCompressibleFeed();
+
+    string frame(ZSTD_compressBound(feed.size()), '\0');
+    frame.resize(ZSTD_compress(&frame[0], frame.size(), feed.data(), feed.size(), 3));
+
+    bool failed = true;
+
+    WriteFile(filename, frame);
+    EXPECT_EQ(ReadAll(filename, failed), feed + "\n");
+    EXPECT_FALSE(failed);
+
+    remove(filename.c_str());
+}
+
+#endif //MD_HAVE_ZSTD
@@ -0,0 +1,145 @@
+//
+//  delimiter_scanner_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 05.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "delimiter_scanner.hpp"
+#include "line_reader.hpp"
+
+using namespace std;
+using namespace md::tokenizers;
+
+/******************************* Helpers ******************************/
+
+/** Line with its tokens flattened to the strings */
+using FlatLine = pair<string, vector<string>>;
+
+string RandomBuffer(size_t size, unsigned seed)
+{
+    const string alphabet = "ORDER ADD,1234567890.\n,,\n";
+    mt19937 generator(seed);
+    uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+
+    string result(size, ' ');
+
+    for (auto &c : result)
+    {
+        c = alphabet[pick(generator)];
+    }
+
+    return result;
+}
+
+vector<FlatLine> ReferenceLines(string_view buffer)
+{
+    vector<FlatLine> result;
+    TokenList tokens;
+
+    md::readers::ForEachLine(buffer, [&](string_view line)
+    {
+        Tokenize(line, ',', tokens);
+
+        vector<string> flat;
+        for (size_t i = 0; i < min(tokens.size(), TokenList::CAPACITY); ++i)
+        {
+            flat.emplace_back(tokens[i]);
+        }
+
+        result.emplace_back(string(line), flat);
+    });
+
+    return result;
+}
+
+vector<FlatLine> BlockLines(string_view buffer, size_t window)
+{
+    vector<FlatLine> result;
+    BlockTokenizer tokenizer(window);
+
+    tokenizer.forEachLine(buffer, [&](string_view line, const TokenList &tokens)
+    {
+        vector<string> flat;
+        for (size_t i = 0; i < min(tokens.size(), TokenList::CAPACITY); ++i)
+        {
+            flat.emplace_back(tokens[i]);
+        }
+
+        result.emplace_back(string(line), flat);
+    });
+
+    return result;
+}
+
+/*********************** DelimiterScannerTestCase *********************/
+
+TEST(DelimiterScannerTestCase, AllLevelsAgreeTest)
+{
+    for (size_t size : {0, 1, 15, 16, 17, 63, 64, 65, 1000, 4099})
+    {
+        const string buffer = RandomBuffer(size, static_cast<unsigned>(size));
+
+        vector<uint32_t> expected(size), actual(size);
+
+        size_t expected_count = ScanDelimiters(SCAN_SCALAR, buffer.data(), size, expected.data());
+        expected.resize(expected_count);
+
+        for (auto level : {SCAN_SSE2, SCAN_AVX2})
+        {
+            actual.assign(size, 0);
+            size_t actual_count = ScanDelimiters(level, buffer.data(), size, actual.data());
+            actual.resize(actual_count);
+
+            EXPECT_EQ(actual, expected) << "size " << size << " level " << level;
+        }
+
+        actual.assign(size, 0);
+        actual.resize(ScanDelimiters(buffer.data(), size, actual.data()));
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(DelimiterScannerTestCase, PositionsTest)
+{
+    const string buffer = "PRINT,AAPL\nORDER CANCEL,1000\n";
+    vector<uint32_t> positions(buffer.size());
+
+    positions.resize(ScanDelimiters(buffer.data(), buffer.size(), positions.data()));
+
+    EXPECT_EQ(positions, (vector<uint32_t>{5, 10, 23, 28}));
+}
+
+/************************ BlockTokenizerTestCase **********************/
+
+TEST(BlockTokenizerTestCase, SameAsLineTokenizeTest)
+{
+    const vector<string> buffers =
+        {
+            "",
+            "\n\n",
+            "PRINT,AAPL",
+            "PRINT,AAPL\n",
+            ",,,\nORDER ADD,1000,AAPL,Buy,10,72.82\n\nPRINT_FULL,AAPL,",
+            "1,2,3,4,5,6,7,8,9,10\nPRINT,AAPL\n",
+            RandomBuffer(10000, 7)
+        };
+
+    for (const auto &buffer : buffers)
+    {
+        const auto expected = ReferenceLines(buffer);
+
+        for (size_t window : vector<size_t>{1, 2, 7, 64, 4096, BlockTokenizer::DEFAULT_WINDOW})
+        {
+            EXPECT_EQ(BlockLines(buffer, window), expected) << "window " << window;
+        }
+    }
+}
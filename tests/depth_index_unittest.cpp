@@ -0,0 +1,93 @@
+//
+//  depth_index_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 18.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+//Local includes
+#include "depth_index.hpp"
+#include "price_ladder_book.hpp"
+
+using namespace std;
+
+/******************************* Tests ********************************/
+
+TEST(DepthIndexTestCase, SearchTest)
+{
+    DepthIndex index;
+    index.reset(10);
+
+    index.update(2, 0, 10, 100);
+    index.update(5, 0, 20, 200);
+    index.update(9, 0, 30, 300);
+
+    EXPECT_EQ(index.totalQuantity(), 60);
+    EXPECT_EQ(index.totalNotional(), 100 * 10 + 200 * 20 + 300 * 30);
+
+    uint64_t covered_quantity, covered_notional;
+
+    EXPECT_EQ(index.search(1, covered_quantity, covered_notional), 2);
+    EXPECT_EQ(covered_quantity, 0);
+    EXPECT_EQ(covered_notional, 0);
+
+    EXPECT_EQ(index.search(10, covered_quantity, covered_notional), 2);
+    EXPECT_EQ(index.search(11, covered_quantity, covered_notional), 5);
+    EXPECT_EQ(covered_quantity, 10);
+    EXPECT_EQ(covered_notional, 100 * 10);
+
+    EXPECT_EQ(index.search(60, covered_quantity, covered_notional), 9);
+    EXPECT_EQ(covered_quantity, 30);
+
+    //Smaller quantity takes the shares out
+    index.update(5, 20, 5, 200);
+
+    EXPECT_EQ(index.totalQuantity(), 45);
+    EXPECT_EQ(index.search(16, covered_quantity, covered_notional), 9);
+    EXPECT_EQ(covered_notional, 100 * 10 + 200 * 5);
+}
+
+TEST(DepthIndexTestCase, StepsTest)
+{
+    vector<DepthStep> steps = {{100, 10, 1000}, {90, 30, 2800}};
+
+    EXPECT_EQ(DepthNotional({}, 5), 0);
+    EXPECT_EQ(DepthNotional(steps, 5), 500);
+    EXPECT_EQ(DepthNotional(steps, 10), 1000);
+    EXPECT_EQ(DepthNotional(steps, 15), 1450);
+
+    //All the levels if there are not enough shares
+    EXPECT_EQ(DepthNotional(steps, 50), 2800);
+}
+
+TEST(DepthIndexTestCase, LadderDepthTest)
+{
+    AskBook book;
+
+    OrderRef first = book.insert(1, 10, 100000);
+    book.insert(2, 20, 100005);
+
+    EXPECT_EQ(book.depthNotional(15), 100000 * 10 + 100005 * 5);
+
+    //Changes after the first query are tracked
+    book.amend(first, 4, true);
+    EXPECT_EQ(book.depthNotional(15), 100000 * 4 + 100005 * 11);
+
+    //Far levels on both sides of the window
+    book.insert(3, 5, 100000 + AskBook::LADDER_SIZE);
+    EXPECT_EQ(book.depthNotional(30), 100000 * 4 + 100005 * 20 + (100000 + AskBook::LADDER_SIZE) * 5);
+
+    book.insert(4, 7, 100000 - AskBook::LADDER_SIZE);
+    EXPECT_EQ(book.depthNotional(7), (100000 - AskBook::LADDER_SIZE) * 7);
+    EXPECT_EQ(book.depthNotional(100), (100000 - AskBook::LADDER_SIZE) * 7 + 100000 * 4 + 100005 * 20 +
+              (100000 + AskBook::LADDER_SIZE) * 5);
+
+    book.erase(first);
+    EXPECT_EQ(book.depthNotional(10), (100000 - AskBook::LADDER_SIZE) * 7 + 100005 * 3);
+}
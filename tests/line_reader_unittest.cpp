@@ -0,0 +1,101 @@
+//
+//  line_reader_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 03.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "line_reader.hpp"
+#include "mapped_file.hpp"
+
+using namespace std;
+using namespace md::readers;
+
+/******************************* Helpers ******************************/
+
+vector<string> CollectLines(string_view buffer)
+{
+    vector<string> lines;
+    ForEachLine(buffer, [&lines](string_view line){ lines.emplace_back(line); });
+    return lines;
+}
+
+/************************** LineReaderTestCase ************************/
+
+TEST(LineReaderTestCase, ForEachLineTest)
+{
+    vector<string> expected = {"PRINT,AAPL", "ORDER CANCEL,1000", "PRINT_FULL,AAPL"};
+
+    EXPECT_EQ(CollectLines("PRINT,AAPL\nORDER CANCEL,1000\nPRINT_FULL,AAPL\n"), expected);
+    EXPECT_EQ(CollectLines("PRINT,AAPL\nORDER CANCEL,1000\nPRINT_FULL,AAPL"), expected);
+    EXPECT_EQ(CollectLines("\n\nPRINT,AAPL\n\nORDER CANCEL,1000\n\n\nPRINT_FULL,AAPL\n\n"), expected);
+}
+
+TEST(LineReaderTestCase, EmptyBufferTest)
+{
+    EXPECT_TRUE(CollectLines("").empty());
+    EXPECT_TRUE(CollectLines("\n").empty());
+    EXPECT_TRUE(CollectLines("\n\n\n").empty());
+}
+
+/************************** MappedFileTestCase ************************/
+
+TEST(MappedFileTestCase, RegularFileTest)
+{
+    const string filename = "mapped_file_unittest.txt";
+    const string content = "ORDER ADD,1000,AAPL,Buy,10,72.82\nPRINT,AAPL\n";
+
+    {
+        ofstream out(filename);
+        out << content;
+    }
+
+    MappedFile file;
+
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file.view().empty());
+
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.view(), content);
+
+    file.close();
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file.view().empty());
+
+    remove(filename.c_str());
+}
+
+TEST(MappedFileTestCase, EmptyFileTest)
+{
+    const string filename = "mapped_file_unittest_empty.txt";
+
+    {
+        ofstream out(filename);
+    }
+
+    MappedFile file;
+
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_TRUE(file.view().empty());
+
+    remove(filename.c_str());
+}
+
+TEST(MappedFileTestCase, UnmappableTest)
+{
+    MappedFile file;
+
+    EXPECT_FALSE(file.open("this_file_does_not_exist.txt"));
+    EXPECT_FALSE(file.open("/dev/null"));
+    EXPECT_FALSE(file.isOpen());
+}
@@ -11,7 +11,7 @@
 #include <limits>
 
 //Local includes
-#include "split.hpp"
+#include "tokenizer.hpp"
 #include "order_add_data.hpp"
 #include "order_modify_data.hpp"
 #include "order_cancel_data.hpp"
@@ -24,9 +24,11 @@ using namespace md::tokenizers;
 
 /******************************* Helpers ******************************/
 
-vector<string> GetTokens(const string & target_command)
+TokenList GetTokens(string_view target_command)
 {
-    return split(target_command, ',');
+    TokenList tokens;
+    Tokenize(target_command, ',', tokens);
+    return tokens;
 }
 
 /**************************** OrderAddData ****************************/
@@ -92,7 +94,7 @@ TEST(OrderAddDataTestCase, EmptyTokenTest)
         };
 
     OrderAddData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -116,7 +118,7 @@ TEST(OrderAddDataTestCase, UnexpectedValuesTest)
     };
 
     OrderAddData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -140,7 +142,7 @@ TEST(OrderAddDataTestCase, NumericalOverflowTest)
     };
 
     OrderAddData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -194,7 +196,7 @@ TEST(OrderModifyDataTestCase, EmptyTokenTest)
         };
 
     OrderModifyData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -217,7 +219,7 @@ TEST(OrderModifyDataTestCase, UnexpectedValuesTest)
     };
 
     OrderModifyData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -241,7 +243,7 @@ TEST(OrderModifyDataTestCase, NumericalOverflowTest)
     };
 
     OrderModifyData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -285,7 +287,7 @@ TEST(OrderCancelDataTestCase, EmptyTokenTest)
         };
 
     OrderCancelData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -306,7 +308,7 @@ TEST(OrderCancelDataTestCase, UnexpectedValuesTest)
     };
 
     OrderCancelData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -328,7 +330,7 @@ TEST(OrderCancelDataTestCase, NumericalOverflowTest)
     };
 
     OrderCancelData obj;
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -372,7 +374,7 @@ TEST(BboSubscriptionDataTestCase, EmptyTokenTest)
         };
 
     BboSubscriptionData obj("SUBSCRIBE BBO");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -392,7 +394,7 @@ TEST(BboSubscriptionDataTestCase, UnexpectedValuesTest)
     };
 
     BboSubscriptionData obj("SUBSCRIBE BBO");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -442,7 +444,7 @@ TEST(VwapSubscriptionDataTestCase, EmptyTokenTest)
         };
 
     VwapSubscriptionData obj("SUBSCRIBE VWAP");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -463,7 +465,7 @@ TEST(VwapSubscriptionDataTestCase, UnexpectedValuesTest)
     };
 
     VwapSubscriptionData obj("SUBSCRIBE VWAP");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -485,7 +487,7 @@ TEST(VwapSubscriptionDataTestCase, NumericalOverflowTest)
     };
 
     VwapSubscriptionData obj("SUBSCRIBE VWAP");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
@@ -529,7 +531,7 @@ TEST(PrintDataTestCase, EmptyTokenTest)
         };
 
     PrintData obj("PRINT");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &command : empty_commands)
     {
@@ -549,7 +551,7 @@ TEST(PrintDataTestCase, UnexpectedValuesTest)
     };
 
     PrintData obj("PRINT");
-    vector<string> tokens;
+    TokenList tokens;
 
     for (const auto &value : commands_to_expected_err_msg)
     {
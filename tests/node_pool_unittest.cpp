@@ -0,0 +1,106 @@
+//
+//  node_pool_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 16.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+//Local includes
+#include "node_pool.hpp"
+
+using namespace std;
+
+/******************************* Tests ********************************/
+
+TEST(NodePoolTestCase, ReuseTest)
+{
+    NodePool pool;
+
+    EXPECT_EQ(pool.nodeSize(), 0);
+    EXPECT_EQ(pool.chunkCount(), 0);
+
+    void *first = pool.allocate(40);
+    void *second = pool.allocate(40);
+
+    EXPECT_EQ(pool.nodeSize(), 40);
+    EXPECT_EQ(pool.chunkCount(), 1);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % alignof(max_align_t), 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(max_align_t), 0);
+
+    //Freed nodes come back first
+    pool.deallocate(first, 40);
+    EXPECT_EQ(pool.allocate(40), first);
+
+    //Other sizes are not taken from the pool
+    void *other = pool.allocate(400);
+    pool.deallocate(other, 400);
+    EXPECT_EQ(pool.chunkCount(), 1);
+
+    pool.deallocate(first, 40);
+    pool.deallocate(second, 40);
+}
+
+TEST(NodePoolTestCase, ChunkGrowthTest)
+{
+    NodePool pool;
+    set<void *> nodes;
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(nodes.insert(pool.allocate(sizeof(uint64_t))).second);
+    }
+
+    //Chunks grow, so there are few of them
+    EXPECT_LT(pool.chunkCount(), 20u);
+
+    for (void *node : nodes)
+    {
+        pool.deallocate(node, sizeof(uint64_t));
+    }
+
+    const size_t chunks = pool.chunkCount();
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        pool.allocate(sizeof(uint64_t));
+    }
+
+    EXPECT_EQ(pool.chunkCount(), chunks);
+}
+
+TEST(NodePoolTestCase, AllocatorTest)
+{
+    NodePool pool;
+
+    map<int, int, less<int>, PoolAllocator<pair<const int, int>>> pooled{PoolAllocator<pair<const int, int>>(&pool)};
+    map<int, int> expected;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        pooled[i * 7 % 1000] = i;
+        expected[i * 7 % 1000] = i;
+    }
+
+    for (int i = 0; i < 1000; i += 3)
+    {
+        pooled.erase(i);
+        expected.erase(i);
+    }
+
+    EXPECT_TRUE(equal(pooled.begin(), pooled.end(), expected.begin(), expected.end()));
+    EXPECT_NE(pool.nodeSize(), 0);
+
+    //Arrays are not taken from the pool
+    vector<int, PoolAllocator<int>> array(100, 1, PoolAllocator<int>(&pool));
+    EXPECT_EQ(array.size(), 100);
+}
@@ -0,0 +1,123 @@
+//
+//  numeric_parser_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 06.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "numeric_parser.hpp"
+
+using namespace std;
+using namespace md::tokenizers;
+
+/*********************** NumericParserTestCase ************************/
+
+TEST(NumericParserTestCase, UnsignedRegularTest)
+{
+    vector<pair<string, uint64_t>> values =
+    {
+        { "0", 0 },
+        { "1000", 1000 },
+        { "0001000", 1000 },
+        { to_string(numeric_limits<uint64_t>::max()), numeric_limits<uint64_t>::max() }
+    };
+
+    for (const auto &value : values)
+    {
+        uint64_t actual = 0;
+
+        EXPECT_EQ(ParseUnsigned(value.first, actual), PARSE_OK) << value.first;
+        EXPECT_EQ(actual, value.second);
+    }
+}
+
+TEST(NumericParserTestCase, UnsignedFailureTest)
+{
+    vector<pair<string, ParseStatus>> values =
+    {
+        { "", PARSE_EMPTY },
+        { "BADORDERID", PARSE_INVALID },
+        { "-1", PARSE_INVALID },
+        { "+1", PARSE_INVALID },
+        { " 1", PARSE_INVALID },
+        { "1.0", PARSE_INVALID },
+        { "18446744073709551616", PARSE_OVERFLOW },
+        { to_string(numeric_limits<uint64_t>::max()) + '1', PARSE_OVERFLOW }
+    };
+
+    for (const auto &value : values)
+    {
+        uint64_t actual = 42;
+
+        EXPECT_EQ(ParseUnsigned(value.first, actual), value.second) << value.first;
+        EXPECT_EQ(actual, 42u);
+    }
+}
+
+TEST(NumericParserTestCase, PriceRegularTest)
+{
+    vector<pair<string, Price>> values =
+    {
+        { "72.82", 728200 },
+        { "72.8", 728000 },
+        { "72.800000", 728000 },
+        { "70", 700000 },
+        { "70.", 700000 },
+        { ".5", 5000 },
+        { "0.0001", 1 },
+        { "-1.25", -12500 },
+        { "922337203685476.9999", 9223372036854769999 }
+    };
+
+    for (const auto &value : values)
+    {
+        Price actual = 0;
+
+        EXPECT_EQ(ParsePrice(value.first, actual), PARSE_OK) << value.first;
+        EXPECT_EQ(actual, value.second);
+    }
+}
+
+TEST(NumericParserTestCase, PriceSameAsStodTest)
+{
+    for (const string value : {"72.82", "72.81", "0.01", "123.4567", "99999.99"})
+    {
+        Price actual = 0;
+
+        EXPECT_EQ(ParsePrice(value, actual), PARSE_OK);
+        EXPECT_EQ(PriceToDouble(actual), stod(value));
+    }
+}
+
+TEST(NumericParserTestCase, PriceFailureTest)
+{
+    vector<pair<string, ParseStatus>> values =
+    {
+        { "", PARSE_EMPTY },
+        { "BADPRICE", PARSE_INVALID },
+        { ".", PARSE_INVALID },
+        { "-", PARSE_INVALID },
+        { "1.2.3", PARSE_INVALID },
+        { "1e5", PARSE_INVALID },
+        { "1.79769e+309", PARSE_INVALID },
+        { "72.82001", PARSE_TOO_PRECISE },
+        { "922337203685477", PARSE_OVERFLOW },
+        { "99999999999999999999", PARSE_OVERFLOW }
+    };
+
+    for (const auto &value : values)
+    {
+        Price actual = 42;
+
+        EXPECT_EQ(ParsePrice(value.first, actual), value.second) << value.first;
+        EXPECT_EQ(actual, 42);
+    }
+}
@@ -29,8 +29,8 @@ TEST(OrderBboTestCase, RegularRunTest)
 
     expected << '|' << setw(default_width) << orders_in_buy_range
             << '|' << setw(default_width) << bbo_buy_volume
-            << '|' << setw(default_width) << fixed << setprecision(default_precision) << bbo_buy_price
-            << '|' << setw(default_width) << fixed << setprecision(default_precision) << bbo_sell_price
+            << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(bbo_buy_price)
+            << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(bbo_sell_price)
             << '|' << setw(default_width) << bbo_sell_volume
             << '|' << setw(default_width) << orders_in_sell_range
             << '|';
@@ -40,7 +40,7 @@ TEST(OrderBboTestCase, RegularRunTest)
 
 TEST(OrderBboTestCase, BuySellNilTest)
 {
-    OrderBbo bbo(0, 0.0, 0, 0, 0.0, 0);
+    OrderBbo bbo(0, 0, 0, 0, 0, 0);
 
     bbo.setBuyNil(true);
     bbo.setSellNil(true);
@@ -62,7 +62,7 @@ TEST(OrderBboTestCase, BuySellNilTest)
 
 TEST(OrderBboTestCase, BuyNilRangeTest)
 {
-    OrderBbo bbo(0, 0.0, 0, bbo_sell_volume, bbo_sell_price, orders_in_sell_range);
+    OrderBbo bbo(0, 0, 0, bbo_sell_volume, bbo_sell_price, orders_in_sell_range);
 
     bbo.setBuyNil(true);
 
@@ -73,7 +73,7 @@ TEST(OrderBboTestCase, BuyNilRangeTest)
     expected << '|' << setw(default_width) << NIL
             << '|' << setw(default_width) << NIL
             << '|' << setw(default_width) << NIL
-            << '|' << setw(default_width) << fixed << setprecision(default_precision) << bbo_sell_price
+            << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(bbo_sell_price)
             << '|' << setw(default_width) << bbo_sell_volume
             << '|' << setw(default_width) << orders_in_sell_range
             << '|';
@@ -83,7 +83,7 @@ TEST(OrderBboTestCase, BuyNilRangeTest)
 
 TEST(OrderBboTestCase, SellNilRangeTest)
 {
-    OrderBbo bbo(bbo_buy_volume, bbo_buy_price, orders_in_buy_range, 0, 0.0, 0);
+    OrderBbo bbo(bbo_buy_volume, bbo_buy_price, orders_in_buy_range, 0, 0, 0);
 
     bbo.setSellNil(true);
 
@@ -93,7 +93,7 @@ TEST(OrderBboTestCase, SellNilRangeTest)
 
     expected << '|' << setw(default_width) << orders_in_buy_range
             << '|' << setw(default_width) << bbo_buy_volume
-            << '|' << setw(default_width) << fixed << setprecision(default_precision) << bbo_buy_price
+            << '|' << setw(default_width) << fixed << setprecision(default_precision) << PriceToDouble(bbo_buy_price)
             << '|' << setw(default_width) << NIL
             << '|' << setw(default_width) << NIL
             << '|' << setw(default_width) << NIL
@@ -111,7 +111,7 @@ TEST(OrderBboTestCase, EqualityOperatorTest)
         bbo_sell_volume, bbo_sell_price, orders_in_sell_range);
 
     OrderBbo bbo_rhs_ne(bbo_buy_volume, bbo_buy_price, orders_in_buy_range + 5,
-        bbo_sell_volume, bbo_sell_price - 0.3, orders_in_sell_range * 2);
+        bbo_sell_volume, bbo_sell_price - 3000, orders_in_sell_range * 2);
 
     EXPECT_EQ(bbo_lhs, bbo_rhs_eq);
     EXPECT_NE(bbo_lhs, bbo_rhs_ne);
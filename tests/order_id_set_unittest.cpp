@@ -0,0 +1,147 @@
+//
+//  order_id_set_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 11.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+//Local includes
+#include "order_id_set.hpp"
+#include "md_processor.hpp"
+#include "order_registry.hpp"
+
+using namespace std;
+using namespace md::processors;
+
+/************************** OrderIdSetTestCase ************************/
+
+TEST(OrderIdSetTestCase, BasicTest)
+{
+    OrderIdSet ids;
+
+    EXPECT_FALSE(ids.contains(0));
+    EXPECT_EQ(ids.size(), 0u);
+
+    ids.insert(0);
+    ids.insert(63);
+    ids.insert(64);
+    ids.insert(OrderIdSet::PAGE_BITS);
+    ids.insert(numeric_limits<uint64_t>::max());
+    ids.insert(64);
+
+    EXPECT_EQ(ids.size(), 5u);
+    EXPECT_TRUE(ids.contains(0));
+    EXPECT_TRUE(ids.contains(63));
+    EXPECT_TRUE(ids.contains(64));
+    EXPECT_FALSE(ids.contains(65));
+    EXPECT_TRUE(ids.contains(OrderIdSet::PAGE_BITS));
+    EXPECT_FALSE(ids.contains(OrderIdSet::PAGE_BITS - 1));
+    EXPECT_TRUE(ids.contains(numeric_limits<uint64_t>::max()));
+
+    ids.erase(63);
+    ids.erase(63);
+    ids.erase(12345678);
+
+    EXPECT_EQ(ids.size(), 4u);
+    EXPECT_FALSE(ids.contains(63));
+
+    ids.clear();
+    EXPECT_EQ(ids.size(), 0u);
+    EXPECT_FALSE(ids.contains(0));
+}
+
+TEST(OrderIdSetTestCase, SameAsSetTest)
+{
+    OrderIdSet ids;
+    set<uint64_t> expected;
+
+    mt19937_64 generator(11);
+    uniform_int_distribution<uint64_t> pick(0, 4 * OrderIdSet::PAGE_BITS);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t id = pick(generator);
+
+        if (i % 3 == 0)
+        {
+            ids.erase(id);
+            expected.erase(id);
+        }
+        else
+        {
+            ids.insert(id);
+            expected.insert(id);
+        }
+
+        ASSERT_EQ(ids.contains(id), expected.count(id) != 0);
+    }
+
+    EXPECT_EQ(ids.size(), expected.size());
+}
+
+/************************* StrictFilterTestCase ***********************/
+
+TEST(StrictFilterTestCase, ProcessFilteredTest)
+{
+    MdProcessor processor;
+    const auto &orders_active = processor.getRegistry().getOrdersActive();
+    processor.setFilter("AAPL");
+    EXPECT_FALSE(processor.isStrictFilter());
+
+    processor.setStrictFilter(true);
+    EXPECT_TRUE(processor.isStrictFilter());
+
+    //Order of the other symbol and its updates are dropped
+    EXPECT_TRUE(processor.processFiltered("ORDER ADD,90000001,MSFT,Buy,1,1"));
+    EXPECT_FALSE(orders_active.contains(90000001));
+    EXPECT_TRUE(processor.processFiltered("ORDER MODIFY,90000001,2,2"));
+
+    //Id is still taken by the dropped order
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000001,AAPL,Buy,1,1"));
+    EXPECT_FALSE(orders_active.contains(90000001));
+
+    //Once cancelled the id is free again
+    EXPECT_TRUE(processor.processFiltered("ORDER CANCEL,90000001"));
+    EXPECT_FALSE(processor.processFiltered("ORDER CANCEL,90000001"));
+    EXPECT_TRUE(processor.processFiltered("ORDER ADD,90000001,AAPL,Buy,1,1"));
+    EXPECT_TRUE(orders_active.contains(90000001));
+
+    //Duplicate of the other symbol goes to the books and does not hide the active order
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000001,MSFT,Buy,1,1"));
+    EXPECT_TRUE(processor.processFiltered("ORDER CANCEL,90000001"));
+    EXPECT_FALSE(orders_active.contains(90000001));
+
+    //Order which the books would reject does not take the id
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000001,MSFT,Buy,0,1"));
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000001,MSFT,Hold,1,1"));
+    EXPECT_TRUE(processor.processFiltered("ORDER ADD,90000001,AAPL,Sell,1,1"));
+    EXPECT_TRUE(processor.processFiltered("ORDER CANCEL,90000001"));
+
+    //Parsing errors are reported before the duplicate
+    EXPECT_TRUE(processor.processFiltered("ORDER ADD,90000003,MSFT,Buy,1,1"));
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000003,AAPL,Hold,1,1"));
+    EXPECT_FALSE(processor.processFiltered("ORDER ADD,90000003,AAPL,Buy,0,1"));
+    EXPECT_TRUE(processor.processFiltered("ORDER CANCEL,90000003"));
+
+    //Fields which the tokenizer would shift are filtered once decoded
+    EXPECT_TRUE(processor.processFiltered("ORDER ADD,,90000002,MSFT,Buy,1,1"));
+    EXPECT_FALSE(orders_active.contains(90000002));
+    EXPECT_TRUE(processor.processFiltered("ORDER CANCEL,90000002"));
+    EXPECT_FALSE(processor.processFiltered("ORDER CANCEL,90000002"));
+
+    //Typed entry points are filtered too
+    EXPECT_TRUE(processor.orderAdd(90000003, "MSFT", OrderSide::BUY, 1, PRICE_SCALE));
+    EXPECT_FALSE(processor.orderAdd(90000003, "MSFT", OrderSide::BUY, 1, PRICE_SCALE));
+    EXPECT_FALSE(orders_active.contains(90000003));
+    EXPECT_TRUE(processor.orderCancel(90000003));
+
+    //No filter symbol, strict mode has no effect
+    processor.setFilter("");
+    EXPECT_FALSE(processor.isStrictFilter());
+}
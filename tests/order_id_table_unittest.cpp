@@ -0,0 +1,133 @@
+//
+//  order_id_table_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 13.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_map>
+
+//Local includes
+#include "order_id_table.hpp"
+
+using namespace std;
+
+/******************************* Helpers ******************************/
+
+/**
+ * Applies the random inserts and erases to the table and to the reference map
+ * and checks that they agree on every step
+ */
+void CheckSameAsMap(OrderIdTable<uint64_t> &table, unordered_map<uint64_t, uint64_t> &expected,
+                    uint64_t first_id, uint64_t id_range, int steps, unsigned seed)
+{
+    mt19937_64 generator(seed);
+    uniform_int_distribution<uint64_t> pick(first_id, first_id + id_range);
+
+    for (int i = 0; i < steps; ++i)
+    {
+        const uint64_t id = pick(generator);
+
+        if (i % 3 == 0)
+        {
+            ASSERT_EQ(table.erase(id), expected.erase(id) != 0);
+        }
+        else
+        {
+            auto added = table.tryEmplace(id);
+            ASSERT_EQ(added.second, expected.count(id) == 0);
+
+            if (added.second)
+            {
+                *added.first = id * 3;
+                expected[id] = id * 3;
+            }
+        }
+
+        const uint64_t *value = table.find(id);
+        ASSERT_EQ(value != nullptr, expected.count(id) != 0);
+
+        if (value != nullptr)
+        {
+            ASSERT_EQ(*value, expected[id]);
+        }
+    }
+
+    ASSERT_EQ(table.size(), expected.size());
+
+    for (const auto &entry : expected)
+    {
+        ASSERT_TRUE(table.contains(entry.first));
+        ASSERT_EQ(*table.find(entry.first), entry.second);
+    }
+}
+
+/************************** OrderIdTableTestCase **********************/
+
+TEST(OrderIdTableTestCase, BasicTest)
+{
+    OrderIdTable<uint64_t> table;
+
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table.find(1), nullptr);
+    EXPECT_FALSE(table.erase(1));
+
+    auto added = table.tryEmplace(1);
+    EXPECT_TRUE(added.second);
+    *added.first = 10;
+
+    added = table.tryEmplace(1);
+    EXPECT_FALSE(added.second);
+    EXPECT_EQ(*added.first, 10u);
+
+    *table.tryEmplace(numeric_limits<uint64_t>::max()).first = 20;
+    *table.tryEmplace(0).first = 30;
+
+    EXPECT_EQ(table.size(), 3u);
+    EXPECT_EQ(*table.find(numeric_limits<uint64_t>::max()), 20u);
+    EXPECT_EQ(*table.find(0), 30u);
+
+    EXPECT_TRUE(table.erase(1));
+    EXPECT_FALSE(table.contains(1));
+    EXPECT_TRUE(table.contains(0));
+    EXPECT_EQ(table.size(), 2u);
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_FALSE(table.contains(0));
+}
+
+TEST(OrderIdTableTestCase, SparseSameAsMapTest)
+{
+    OrderIdTable<uint64_t> table;
+    unordered_map<uint64_t, uint64_t> expected;
+
+    CheckSameAsMap(table, expected, 0, numeric_limits<uint64_t>::max() - 1, 100000, 17);
+    EXPECT_FALSE(table.isDense());
+}
+
+TEST(OrderIdTableTestCase, DenseSameAsMapTest)
+{
+    OrderIdTable<uint64_t> table;
+    unordered_map<uint64_t, uint64_t> expected;
+
+    //Sequential ids switch the table to the pages
+    for (uint64_t id = 1000000; id < 1000000 + OrderIdTable<uint64_t>::DENSE_MIN_INSERTS; ++id)
+    {
+        *table.tryEmplace(id).first = id * 3;
+        expected[id] = id * 3;
+    }
+
+    EXPECT_TRUE(table.isDense());
+    EXPECT_EQ(table.size(), OrderIdTable<uint64_t>::DENSE_MIN_INSERTS);
+    EXPECT_EQ(*table.find(1000000), 3000000u);
+
+    //Ids around the pages, below them and far above them
+    CheckSameAsMap(table, expected, 900000, 200000, 100000, 23);
+    CheckSameAsMap(table, expected, 1000000, numeric_limits<uint32_t>::max(), 20000, 29);
+    EXPECT_TRUE(table.isDense());
+}
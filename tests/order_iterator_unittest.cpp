@@ -17,13 +17,40 @@
 
 using namespace std;
 
-/****************************** Constants *****************************/
+/******************************* Helpers ******************************/
 
-auto orders_buy_ptr = make_shared<multiset<OrderRequest, greater<OrderRequest>>>(
-        initializer_list<OrderRequest>{ order_one, order_two, order_three, order_four } );
+template <typename Book>
+void FillIteratorBook(Book &book, initializer_list<OrderRequest> orders)
+{
+    for (const auto &order : orders)
+    {
+        book.insert(order.order_id, order.quantity, order.price);
+    }
+}
+
+const BidBook & IteratorBuyBook()
+{
+    static BidBook book;
+
+    if (book.empty())
+    {
+        FillIteratorBook(book, { order_one, order_two, order_three, order_four });
+    }
 
-auto orders_sell_ptr = make_shared<multiset<OrderRequest, less<OrderRequest>>>(
-        initializer_list<OrderRequest>{ order_one, order_two, order_three, order_four } );
+    return book;
+}
+
+const AskBook & IteratorSellBook()
+{
+    static AskBook book;
+
+    if (book.empty())
+    {
+        FillIteratorBook(book, { order_one, order_two, order_three, order_four });
+    }
+
+    return book;
+}
 
 /************************ OrderIteratorTestCase ***********************/
 
@@ -32,7 +59,7 @@ TEST(OrderIteratorTestCase, FirstElementOnInitTest)
     const auto &bid_expected = order_one;
     const auto &ask_expected = order_four;
 
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     const auto &bid_actual = itr.getBid();
     const auto &ask_actual = itr.getAsk();
@@ -46,7 +73,7 @@ TEST(OrderIteratorTestCase, BackToFirstTest)
     const auto &bid_expected = order_one;
     const auto &ask_expected = order_four;
 
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     itr.next();
     itr.next();
@@ -65,7 +92,7 @@ TEST(OrderIteratorTestCase, ForwardTraverseTest)
     const auto &bid_expected = order_three;
     const auto &ask_expected = order_two;
 
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     itr.next();
     itr.next();
@@ -79,7 +106,7 @@ TEST(OrderIteratorTestCase, ForwardTraverseTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnInitTest)
 {
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     OrderIterator::DoneStatus actual = itr.done();
     OrderIterator::DoneStatus expected = OrderIterator::NOT_DONE;
@@ -89,10 +116,10 @@ TEST(OrderIteratorTestCase, DoneStatusOnInitTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnInitWithEmptyContainersTest)
 {
-    auto empty_orders_buy_ptr = make_shared<multiset<OrderRequest, greater<OrderRequest>>>();
-    auto empty_orders_sell_ptr = make_shared<multiset<OrderRequest, less<OrderRequest>>>();
+    BidBook empty_orders_buy;
+    AskBook empty_orders_sell;
 
-    OrderIterator itr(empty_orders_buy_ptr, empty_orders_sell_ptr);
+    OrderIterator itr(empty_orders_buy, empty_orders_sell);
 
     OrderIterator::DoneStatus actual = itr.done();
     OrderIterator::DoneStatus expected = OrderIterator::ALL_DONE;
@@ -102,7 +129,7 @@ TEST(OrderIteratorTestCase, DoneStatusOnInitWithEmptyContainersTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnTraverseTest)
 {
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     itr.next();
     itr.next();
@@ -115,7 +142,7 @@ TEST(OrderIteratorTestCase, DoneStatusOnTraverseTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnListEndTest)
 {
-    OrderIterator itr(orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), IteratorSellBook());
 
     itr.next();
     itr.next();
@@ -130,10 +157,10 @@ TEST(OrderIteratorTestCase, DoneStatusOnListEndTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnUnEqualBuyListTest)
 {
-    auto unequal_orders_buy_ptr = make_shared<multiset<OrderRequest, greater<OrderRequest>>>(
-        initializer_list<OrderRequest>{ order_one, order_two } );
+    BidBook unequal_orders_buy;
+    FillIteratorBook(unequal_orders_buy, { order_one, order_two });
 
-    OrderIterator itr(unequal_orders_buy_ptr, orders_sell_ptr);
+    OrderIterator itr(unequal_orders_buy, IteratorSellBook());
 
     itr.next();
     itr.next();
@@ -154,10 +181,10 @@ TEST(OrderIteratorTestCase, DoneStatusOnUnEqualBuyListTest)
 
 TEST(OrderIteratorTestCase, DoneStatusOnUnEqualSellListTest)
 {
-    auto unequal_orders_sell_ptr = make_shared<multiset<OrderRequest, less<OrderRequest>>>(
-        initializer_list<OrderRequest>{ order_one, order_two } );
+    AskBook unequal_orders_sell;
+    FillIteratorBook(unequal_orders_sell, { order_one, order_two });
 
-    OrderIterator itr(orders_buy_ptr, unequal_orders_sell_ptr);
+    OrderIterator itr(IteratorBuyBook(), unequal_orders_sell);
 
     itr.next();
     itr.next();
@@ -176,3 +203,21 @@ TEST(OrderIteratorTestCase, DoneStatusOnUnEqualSellListTest)
     EXPECT_EQ(actual, expected);
 }
 
+
+TEST(OrderIteratorTestCase, ArrivalOrderInLevelTest)
+{
+    BidBook orders_buy;
+    AskBook orders_sell;
+    FillIteratorBook(orders_buy, { order_one, order_two, order_one_dub });
+
+    OrderIterator itr(orders_buy, orders_sell);
+
+    EXPECT_EQ(itr.getBid(), order_one);
+    itr.next();
+    EXPECT_EQ(itr.getBid(), order_one_dub);
+    EXPECT_EQ(itr.getBid().order_id, order_one_dub.order_id);
+    itr.next();
+    EXPECT_EQ(itr.getBid(), order_two);
+    itr.next();
+    EXPECT_EQ(itr.done(), OrderIterator::ALL_DONE);
+}
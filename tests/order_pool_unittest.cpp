@@ -0,0 +1,72 @@
+//
+//  order_pool_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 17.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+//Local includes
+#include "order_pool.hpp"
+
+using namespace std;
+
+/******************************* Tests ********************************/
+
+TEST(OrderPoolTestCase, ReuseTest)
+{
+    OrderPool pool;
+
+    EXPECT_EQ(pool.size(), 0);
+
+    OrderRef first = pool.allocate(1, 10, 100);
+    OrderRef second = pool.allocate(2, 20, 200);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_EQ(pool.orderId(first), 1);
+    EXPECT_EQ(pool.node(second).quantity, 20);
+    EXPECT_EQ(pool.node(second).price, 200);
+    EXPECT_EQ(pool.node(first).prev, NO_ORDER);
+    EXPECT_EQ(pool.node(first).next, NO_ORDER);
+
+    OrderRequest request = pool.request(second);
+    EXPECT_EQ(request.order_id, 2);
+    EXPECT_EQ(request.quantity, 20);
+    EXPECT_EQ(request.price, 200);
+
+    //Freed orders come back first
+    pool.deallocate(first);
+    EXPECT_EQ(pool.size(), 1);
+
+    EXPECT_EQ(pool.allocate(3, 30, 300), first);
+    EXPECT_EQ(pool.orderId(first), 3);
+    EXPECT_EQ(pool.node(first).next, NO_ORDER);
+}
+
+TEST(OrderPoolTestCase, GrowthTest)
+{
+    OrderPool pool;
+    vector<OrderRef> orders;
+
+    //References stay valid while the storage grows
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        orders.push_back(pool.allocate(i, i + 1, static_cast<Price>(i * 2)));
+    }
+
+    EXPECT_EQ(pool.size(), orders.size());
+
+    for (uint64_t i = 0; i < orders.size(); ++i)
+    {
+        EXPECT_EQ(orders[i], i);
+        EXPECT_EQ(pool.orderId(orders[i]), i);
+        EXPECT_EQ(pool.node(orders[i]).quantity, i + 1);
+        EXPECT_EQ(pool.node(orders[i]).price, static_cast<Price>(i * 2));
+    }
+}
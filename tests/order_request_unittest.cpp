@@ -25,7 +25,7 @@ TEST(OrderRequestTestCase, OperatorLessTest)
 
     lhs = {DEFAULT_ORDER_ID, DEFAULT_QUANTITY, DEFAULT_PRICE};
     rhs = lhs;
-    rhs.price += 2.0;
+    rhs.price += 2 * PRICE_SCALE;
 
     EXPECT_LT(lhs, rhs);
 }
@@ -36,7 +36,7 @@ TEST(OrderRequestTestCase, OperatorGreaterThanTest)
 
     rhs = {DEFAULT_ORDER_ID, DEFAULT_QUANTITY, DEFAULT_PRICE};
     lhs = rhs;
-    lhs.price += 2.0;
+    lhs.price += 2 * PRICE_SCALE;
 
     EXPECT_GT(lhs, rhs);
 }
@@ -57,8 +57,8 @@ TEST(OrderRequestTestCase, VwapOutStreamTest)
     OrderVwap obj = {DEFAULT_PRICE, DEFAULT_PRICE};
 
     actual << obj;
-    expected << '<' << fixed << setprecision(2) << DEFAULT_PRICE << ','
-        << fixed << setprecision(2) << DEFAULT_PRICE << '>';
+    expected << '<' << fixed << setprecision(2) << PriceToDouble(DEFAULT_PRICE) << ','
+        << fixed << setprecision(2) << PriceToDouble(DEFAULT_PRICE) << '>';
 
     EXPECT_EQ(actual.str(), expected.str());
 }
@@ -70,7 +70,7 @@ TEST(OrderRequestTestCase, VwapOutStreamBuyNilTest)
 
     actual << obj;
     expected << '<' << fixed << setprecision(2) << NIL << ','
-        << fixed << setprecision(2) << DEFAULT_PRICE << '>';
+        << fixed << setprecision(2) << PriceToDouble(DEFAULT_PRICE) << '>';
 
     EXPECT_EQ(actual.str(), expected.str());
 }
@@ -81,7 +81,7 @@ TEST(OrderRequestTestCase, VwapOutStreamSellNilTest)
     OrderVwap obj = {DEFAULT_PRICE, 0.0};
 
     actual << obj;
-    expected << '<' << fixed << setprecision(2) << DEFAULT_PRICE << ','
+    expected << '<' << fixed << setprecision(2) << PriceToDouble(DEFAULT_PRICE) << ','
         << fixed << setprecision(2) << NIL << '>';
 
     EXPECT_EQ(actual.str(), expected.str());
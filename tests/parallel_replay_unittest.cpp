@@ -0,0 +1,267 @@
+//
+//  parallel_replay_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 08.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Local includes
+#include "parallel_replay.hpp"
+#include "md_decoder.hpp"
+#include "md_processor.hpp"
+#include "order_registry.hpp"
+
+using namespace std;
+using namespace md::tokenizers;
+using md::processors::ParallelReplay;
+using md::processors::MdProcessor;
+
+/******************************* Helpers ******************************/
+
+MdCommand Decode(MdDecoder &decoder, string_view line)
+{
+    TokenList tokens;
+    MdCommand command;
+
+    Tokenize(line, ',', tokens);
+    decoder.decode(line, tokens, command);
+
+    return command;
+}
+
+uint64_t ActiveQuantity(MdProcessor &processor, uint64_t order_id)
+{
+    OrderRegistry &registry = processor.getRegistry();
+    const OrderHandle *handle = registry.getOrdersActive().find(order_id);
+
+    return registry.findOrderList(handle->symbol)->order(handle->side, handle->order).quantity;
+}
+
+/************************** MdDecoderTestCase *************************/
+
+TEST(MdDecoderTestCase, ValidCommandsTest)
+{
+    MdDecoder decoder;
+
+    MdCommand command = Decode(decoder, "ORDER ADD,1000,AAPL,Sell,10,72.82");
+    EXPECT_EQ(command.type, COMMAND_ORDER_ADD);
+    EXPECT_EQ(command.order_id, 1000u);
+    EXPECT_EQ(command.symbol, "AAPL");
+    EXPECT_EQ(command.side, OrderSide::SELL);
+    EXPECT_EQ(command.quantity, 10u);
+    EXPECT_EQ(command.price, 728200);
+    EXPECT_EQ(command.line, "ORDER ADD,1000,AAPL,Sell,10,72.82");
+
+    command = Decode(decoder, "ORDER MODIFY,1000,5,72");
+    EXPECT_EQ(command.type, COMMAND_ORDER_MODIFY);
+    EXPECT_EQ(command.order_id, 1000u);
+    EXPECT_EQ(command.quantity, 5u);
+    EXPECT_EQ(command.price, 720000);
+    EXPECT_TRUE(command.symbol.empty());
+
+    EXPECT_EQ(Decode(decoder, "ORDER CANCEL,1000").type, COMMAND_ORDER_CANCEL);
+    EXPECT_EQ(Decode(decoder, "SUBSCRIBE BBO,AAPL").type, COMMAND_SUBSCRIBE_BBO);
+    EXPECT_EQ(Decode(decoder, "UNSUBSCRIBE BBO,AAPL").type, COMMAND_UNSUBSCRIBE_BBO);
+    EXPECT_EQ(Decode(decoder, "SUBSCRIBE VWAP,AAPL,100").quantity, 100u);
+    EXPECT_EQ(Decode(decoder, "UNSUBSCRIBE VWAP,AAPL,100").type, COMMAND_UNSUBSCRIBE_VWAP);
+    EXPECT_EQ(Decode(decoder, "PRINT,AAPL").symbol, "AAPL");
+    EXPECT_EQ(Decode(decoder, "PRINT_FULL,AAPL").type, COMMAND_PRINT_FULL);
+}
+
+TEST(MdDecoderTestCase, CommandTypeOfTest)
+{
+    EXPECT_EQ(CommandTypeOf("ORDER ADD"), COMMAND_ORDER_ADD);
+    EXPECT_EQ(CommandTypeOf("ORDER MODIFY"), COMMAND_ORDER_MODIFY);
+    EXPECT_EQ(CommandTypeOf("ORDER CANCEL"), COMMAND_ORDER_CANCEL);
+    EXPECT_EQ(CommandTypeOf("SUBSCRIBE BBO"), COMMAND_SUBSCRIBE_BBO);
+    EXPECT_EQ(CommandTypeOf("UNSUBSCRIBE BBO"), COMMAND_UNSUBSCRIBE_BBO);
+    EXPECT_EQ(CommandTypeOf("SUBSCRIBE VWAP"), COMMAND_SUBSCRIBE_VWAP);
+    EXPECT_EQ(CommandTypeOf("UNSUBSCRIBE VWAP"), COMMAND_UNSUBSCRIBE_VWAP);
+    EXPECT_EQ(CommandTypeOf("PRINT"), COMMAND_PRINT);
+    EXPECT_EQ(CommandTypeOf("PRINT_FULL"), COMMAND_PRINT_FULL);
+
+    //Same length as the known names
+    for (string_view name : {"", "print", "ORDER DEL", "ORDER MODIFX", "ORDER XANCEL",
+                             "SUBSCRIBE BB", "PRINT_FULL ", "UNSUBSCRIBE VWAQ"})
+    {
+        EXPECT_EQ(CommandTypeOf(name), COMMAND_INVALID) << name;
+    }
+}
+
+TEST(MdDecoderTestCase, InvalidCommandsTest)
+{
+    MdDecoder decoder;
+
+    for (string_view line : {"GARBAGE", ",,,", "ORDER ADD,1,2", "ORDER ADD,x,AAPL,Buy,1,1",
+                             "ORDER ADD,1,AAPL,Hold,1,1", "ORDER MODIFY,5,abc,1.0", "PRINT"})
+    {
+        const MdCommand command = Decode(decoder, line);
+        EXPECT_EQ(command.type, COMMAND_INVALID) << line;
+        EXPECT_EQ(command.line, line);
+    }
+}
+
+TEST(MdDecoderTestCase, FailureReasonTest)
+{
+    MdDecoder decoder;
+
+    Decode(decoder, "GARBAGE,1");
+    EXPECT_EQ(decoder.failedType(), COMMAND_INVALID);
+    EXPECT_TRUE(decoder.errorMessage().empty());
+
+    Decode(decoder, "ORDER ADD,1,AAPL,Hold,1,1");
+    EXPECT_EQ(decoder.failedType(), COMMAND_ORDER_ADD);
+    EXPECT_EQ(decoder.errorMessage(), "Bad side");
+
+    Decode(decoder, "PRINT");
+    EXPECT_EQ(decoder.failedType(), COMMAND_PRINT);
+    EXPECT_FALSE(decoder.errorMessage().empty());
+
+    //Successful decode clears the failure
+    Decode(decoder, "PRINT,AAPL");
+    EXPECT_EQ(decoder.failedType(), COMMAND_INVALID);
+    EXPECT_TRUE(decoder.errorMessage().empty());
+}
+
+/************************ ProcessBatchTestCase ************************/
+
+TEST(ProcessBatchTestCase, InOrderTest)
+{
+    MdDecoder decoder;
+    MdProcessor processor;
+    const auto &orders_active = processor.getRegistry().getOrdersActive();
+    processor.setFilter("BATCH");
+
+    const vector<string> lines =
+    {
+        "ORDER ADD,80000001,BATCH,Buy,10,1.5",
+        "ORDER MODIFY,80000001,20,1.6",
+        "ORDER ADD,80000001,BATCH,Buy,10,1.5",
+        "GARBAGE,1",
+        "ORDER ADD,80000002,BATCH,Sell,5,2",
+        "ORDER CANCEL,80000001"
+    };
+
+    vector<MdCommand> commands(lines.size());
+
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        commands[i] = Decode(decoder, lines[i]);
+    }
+
+    vector<string_view> failed;
+
+    const size_t processed = processor.processBatch(commands.data(), commands.size(),
+        [&failed](const MdCommand &command){ failed.push_back(command.line); });
+
+    EXPECT_EQ(processed, 4u);
+    ASSERT_EQ(failed.size(), 2u);
+    EXPECT_EQ(failed[0], lines[2]);
+    EXPECT_EQ(failed[1], lines[3]);
+
+    EXPECT_FALSE(orders_active.contains(80000001));
+    EXPECT_TRUE(orders_active.contains(80000002));
+
+    EXPECT_EQ(processor.processBatch(nullptr, 0, nullptr), 0u);
+    EXPECT_TRUE(processor.orderCancel(80000002));
+}
+
+TEST(ProcessBatchTestCase, IndependentProcessorsTest)
+{
+    MdProcessor first, second;
+
+    //Same id in both replays
+    EXPECT_TRUE(first.processFiltered("ORDER ADD,1,ONE,Buy,10,10"));
+    EXPECT_TRUE(second.processFiltered("ORDER ADD,1,TWO,Sell,20,20"));
+    EXPECT_FALSE(first.processFiltered("PRINT,TWO"));
+
+    ASSERT_NE(first.getRegistry().getOrdersActive().find(1), nullptr);
+    EXPECT_EQ(ActiveQuantity(first, 1), 10u);
+    EXPECT_EQ(ActiveQuantity(second, 1), 20u);
+
+    EXPECT_TRUE(first.processFiltered("ORDER CANCEL,1"));
+    EXPECT_FALSE(first.getRegistry().getOrdersActive().contains(1));
+    EXPECT_TRUE(second.getRegistry().getOrdersActive().contains(1));
+
+    //Replays on their own threads
+    vector<thread> replays;
+    vector<unique_ptr<MdProcessor>> processors;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        processors.push_back(make_unique<MdProcessor>());
+        MdProcessor &processor = *processors.back();
+
+        replays.emplace_back([&processor]()
+        {
+            for (uint64_t id = 1; id <= 1000; ++id)
+            {
+                processor.orderAdd(id, "THREAD", OrderSide::BUY, id, PRICE_SCALE);
+            }
+
+            for (uint64_t id = 1; id <= 1000; id += 2)
+            {
+                processor.orderCancel(id);
+            }
+        });
+    }
+
+    for (auto &replay : replays)
+    {
+        replay.join();
+    }
+
+    for (const auto &processor : processors)
+    {
+        EXPECT_EQ(processor->getRegistry().getOrdersActive().size(), 500u);
+    }
+}
+
+/************************ ParallelReplayTestCase **********************/
+
+TEST(ParallelReplayTestCase, SplitChunksTest)
+{
+    string feed;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        feed += "ORDER CANCEL," + to_string(i) + "\n";
+
+        if (i % 7 == 0)
+        {
+            feed += "\n";
+        }
+    }
+
+    feed += "PRINT,AAPL";
+
+    for (size_t chunk_size : {1, 2, 16, 100, 4096, 1 << 20})
+    {
+        const auto chunks = ParallelReplay::SplitChunks(feed, chunk_size);
+
+        string joined;
+
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            EXPECT_FALSE(chunks[i].empty());
+
+            if (i + 1 < chunks.size())
+            {
+                EXPECT_EQ(chunks[i].back(), '\n') << "chunk size " << chunk_size;
+            }
+
+            joined += chunks[i];
+        }
+
+        EXPECT_EQ(joined, feed);
+    }
+
+    EXPECT_TRUE(ParallelReplay::SplitChunks("", 16).empty());
+}
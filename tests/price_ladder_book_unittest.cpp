@@ -0,0 +1,197 @@
+//
+//  price_ladder_book_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 15.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+//Local includes
+#include "price_ladder_book.hpp"
+
+using namespace std;
+
+/******************************* Helpers ******************************/
+
+/**
+ * Checks that the ladder holds the same levels and orders as the reference book
+ */
+template <typename Compare>
+void CheckSameLevels(const PriceLadderBook<Compare> &ladder, const PriceLevelBook<Compare> &expected)
+{
+    ASSERT_EQ(ladder.empty(), expected.empty());
+    ASSERT_EQ(ladder.levelCount(), expected.levelCount());
+
+    if (!expected.empty())
+    {
+        EXPECT_EQ(ladder.best().price, expected.best().price);
+        EXPECT_EQ(ladder.best().total_quantity, expected.best().total_quantity);
+    }
+
+    auto expected_level = expected.begin();
+
+    for (const PriceLevel &level : ladder)
+    {
+        ASSERT_NE(expected_level, expected.end());
+        ASSERT_EQ(level.price, expected_level->first);
+        ASSERT_EQ(level.total_quantity, expected_level->second.total_quantity);
+        ASSERT_EQ(level.order_count, expected_level->second.order_count);
+
+        OrderRef expected_order = expected_level->second.head;
+
+        for (OrderRef order = level.head; order != NO_ORDER; order = ladder.orders().node(order).next)
+        {
+            ASSERT_NE(expected_order, NO_ORDER);
+            ASSERT_EQ(ladder.orders().orderId(order), expected.orders().orderId(expected_order));
+            ASSERT_EQ(ladder.orders().node(order).price, level.price);
+            expected_order = expected.orders().node(expected_order).next;
+        }
+
+        ASSERT_EQ(expected_order, NO_ORDER);
+        ++expected_level;
+    }
+
+    ASSERT_EQ(expected_level, expected.end());
+}
+
+/**
+ * Checks that the depth of the ladder is the same as the walk over the levels
+ * of the reference book
+ */
+template <typename Compare>
+void CheckSameDepth(PriceLadderBook<Compare> &ladder, const PriceLevelBook<Compare> &expected)
+{
+    uint64_t total = 0;
+
+    for (auto level = expected.begin(); level != expected.end(); ++level)
+    {
+        total += level->second.total_quantity;
+    }
+
+    for (uint64_t quantity : {uint64_t(1), total / 3, total / 2, total, total + 7})
+    {
+        uint64_t left = quantity, notional = 0;
+
+        for (auto level = expected.begin(); level != expected.end() && left != 0; ++level)
+        {
+            uint64_t taken = min(left, level->second.total_quantity);
+
+            notional += static_cast<uint64_t>(level->first) * taken;
+            left -= taken;
+        }
+
+        ASSERT_EQ(ladder.depthNotional(quantity), notional);
+    }
+}
+
+/**
+ * Applies the random inserts and erases to the ladder and to the reference
+ * book. Prices walk far enough to move the window many times
+ */
+template <typename Compare>
+void CheckSameAsLevelBook(unsigned seed)
+{
+    PriceLadderBook<Compare> ladder;
+    PriceLevelBook<Compare> expected;
+    vector<pair<OrderRef, OrderRef>> live;
+
+    mt19937_64 generator(seed);
+    uniform_int_distribution<int> pick_action(0, 2);
+    uniform_int_distribution<Price> pick_offset(-600, 600);
+    uniform_int_distribution<Price> pick_drift(-40, 40);
+    uniform_int_distribution<uint64_t> pick_quantity(1, 100);
+
+    Price centre = 100000;
+
+    for (uint64_t order_id = 1; order_id < 20000; ++order_id)
+    {
+        centre += pick_drift(generator);
+
+        if (live.empty() || pick_action(generator) != 0)
+        {
+            Price price = centre + pick_offset(generator);
+            uint64_t quantity = pick_quantity(generator);
+
+            live.emplace_back(ladder.insert(order_id, quantity, price),
+                              expected.insert(order_id, quantity, price));
+        }
+        else
+        {
+            size_t victim = generator() % live.size();
+
+            ladder.erase(live[victim].first);
+            expected.erase(live[victim].second);
+
+            live[victim] = live.back();
+            live.pop_back();
+        }
+
+        if (order_id % 500 == 0)
+        {
+            CheckSameLevels(ladder, expected);
+            CheckSameDepth(ladder, expected);
+        }
+    }
+
+    CheckSameLevels(ladder, expected);
+    CheckSameDepth(ladder, expected);
+}
+
+/******************************* Tests ********************************/
+
+TEST(PriceLadderBookTestCase, WindowTest)
+{
+    BidBook book;
+
+    EXPECT_TRUE(book.empty());
+    EXPECT_EQ(book.begin(), book.end());
+
+    OrderRef first = book.insert(1, 10, 100000);
+    book.insert(2, 20, 100000);
+    book.insert(3, 30, 99990);
+
+    EXPECT_EQ(book.levelCount(), 2);
+    EXPECT_EQ(book.sparseLevelCount(), 0);
+    EXPECT_EQ(book.best().price, 100000);
+    EXPECT_EQ(book.best().total_quantity, 30);
+    EXPECT_EQ(book.best().head, first);
+
+    // Far below the touch, goes to the sparse levels
+    book.insert(4, 40, 100000 - BidBook::LADDER_SIZE);
+
+    EXPECT_EQ(book.levelCount(), 3);
+    EXPECT_EQ(book.sparseLevelCount(), 1);
+    EXPECT_EQ(book.best().price, 100000);
+
+    // Touch moves up out of the window, the window follows it
+    OrderRef top = book.insert(5, 50, 100000 + BidBook::LADDER_SIZE);
+
+    EXPECT_EQ(book.levelCount(), 4);
+    EXPECT_EQ(book.sparseLevelCount(), 3);
+    EXPECT_EQ(book.best().price, 100000 + static_cast<Price>(BidBook::LADDER_SIZE));
+
+    // Touch goes back, best comes from the sparse levels
+    book.erase(top);
+
+    EXPECT_EQ(book.levelCount(), 3);
+    EXPECT_EQ(book.best().price, 100000);
+    EXPECT_EQ(book.best().total_quantity, 30);
+    EXPECT_EQ(book.best().head, first);
+    EXPECT_EQ(book.orders().node(first).price, book.best().price);
+}
+
+TEST(PriceLadderBookTestCase, BidSameAsLevelBookTest)
+{
+    CheckSameAsLevelBook<greater<Price>>(7);
+}
+
+TEST(PriceLadderBookTestCase, AskSameAsLevelBookTest)
+{
+    CheckSameAsLevelBook<less<Price>>(11);
+}
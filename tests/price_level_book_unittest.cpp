@@ -0,0 +1,99 @@
+//
+//  price_level_book_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 14.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+
+//Local includes
+#include "price_level_book.hpp"
+
+using namespace std;
+
+/****************************** Constants *****************************/
+
+using LevelBidBook = PriceLevelBook<greater<Price>>;
+using LevelAskBook = PriceLevelBook<less<Price>>;
+
+/******************************* Tests ********************************/
+
+TEST(PriceLevelBookTestCase, LevelTotalsTest)
+{
+    LevelBidBook book;
+
+    EXPECT_TRUE(book.empty());
+    EXPECT_EQ(book.levelCount(), 0);
+
+    OrderRef first = book.insert(1, 10, 100);
+    OrderRef second = book.insert(2, 20, 100);
+    book.insert(3, 30, 90);
+
+    EXPECT_FALSE(book.empty());
+    EXPECT_EQ(book.levelCount(), 2);
+    EXPECT_EQ(book.best().price, 100);
+    EXPECT_EQ(book.best().total_quantity, 30);
+    EXPECT_EQ(book.best().order_count, 2);
+    EXPECT_EQ(book.best().head, first);
+    EXPECT_EQ(book.best().tail, second);
+    EXPECT_EQ(book.orders().node(first).next, second);
+    EXPECT_EQ(book.orders().node(second).prev, first);
+
+    book.erase(first);
+
+    EXPECT_EQ(book.best().total_quantity, 20);
+    EXPECT_EQ(book.best().order_count, 1);
+    EXPECT_EQ(book.best().head, second);
+    EXPECT_EQ(book.orders().node(second).prev, NO_ORDER);
+
+    book.erase(second);
+
+    EXPECT_EQ(book.levelCount(), 1);
+    EXPECT_EQ(book.best().price, 90);
+}
+
+TEST(PriceLevelBookTestCase, LevelOrderTest)
+{
+    LevelBidBook bids;
+    LevelAskBook asks;
+
+    for (Price price : {100, 120, 80, 110})
+    {
+        bids.insert(price, 1, price);
+        asks.insert(price, 1, price);
+    }
+
+    Price expected_bids[] = {120, 110, 100, 80};
+    Price expected_asks[] = {80, 100, 110, 120};
+
+    size_t index = 0;
+    for (auto level = bids.begin(); level != bids.end(); ++level, ++index)
+    {
+        EXPECT_EQ(level->first, expected_bids[index]);
+    }
+
+    index = 0;
+    for (auto level = asks.begin(); level != asks.end(); ++level, ++index)
+    {
+        EXPECT_EQ(level->first, expected_asks[index]);
+    }
+}
+
+TEST(PriceLevelBookTestCase, MiddleEraseTest)
+{
+    LevelAskBook book;
+
+    OrderRef first = book.insert(1, 10, 100);
+    OrderRef middle = book.insert(2, 20, 100);
+    OrderRef last = book.insert(3, 30, 100);
+
+    book.erase(middle);
+
+    EXPECT_EQ(book.orders().node(first).next, last);
+    EXPECT_EQ(book.orders().node(last).prev, first);
+    EXPECT_EQ(book.best().total_quantity, 40);
+    EXPECT_EQ(book.best().order_count, 2);
+}
@@ -0,0 +1,130 @@
+//
+//  read_ahead_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 09.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "read_ahead.hpp"
+#include "line_reader.hpp"
+
+using namespace std;
+using namespace md::readers;
+using md::tokenizers::TokenList;
+
+/******************************* Helpers ******************************/
+
+/** Line with its tokens flattened to the strings */
+using ReadLine = pair<string, vector<string>>;
+
+ReadLine FlattenReadLine(string_view line, const TokenList &tokens)
+{
+    vector<string> flat;
+
+    for (size_t i = 0; i < min(tokens.size(), TokenList::CAPACITY); ++i)
+    {
+        flat.emplace_back(tokens[i]);
+    }
+
+    return ReadLine(string(line), flat);
+}
+
+vector<ReadLine> ReadAheadLines(const string &filename, size_t buffer_size)
+{
+    vector<ReadLine> result;
+    ReadAheadReader reader(buffer_size);
+
+    EXPECT_TRUE(reader.open(filename));
+
+    reader.forEachLine([&result](string_view line, const TokenList &tokens)
+    {
+        result.push_back(FlattenReadLine(line, tokens));
+    });
+
+    EXPECT_FALSE(reader.failed());
+    return result;
+}
+
+vector<ReadLine> StreamReferenceLines(string_view content)
+{
+    vector<ReadLine> result;
+    TokenList tokens;
+
+    ForEachLine(content, [&](string_view line)
+    {
+        md::tokenizers::Tokenize(line, ',', tokens);
+        result.push_back(FlattenReadLine(line, tokens));
+    });
+
+    return result;
+}
+
+/************************ ReadAheadReaderTestCase *********************/
+
+TEST(ReadAheadReaderTestCase, SameAsLineReaderTest)
+{
+    const string filename = "read_ahead_unittest.txt";
+
+    string long_line = "PRINT_FULL," + string(300, 'A');
+    string feed;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        feed += "ORDER ADD," + to_string(i) + ",AAPL,Buy,10,72.82\n";
+        feed += (i % 10 == 0) ? "\n\n" + long_line + "\n" : "PRINT,AAPL\n";
+    }
+
+    for (const string &content : {string(), string("\n"), string("PRINT,AAPL"), feed, feed + "ORDER CANCEL,1"})
+    {
+        {
+            ofstream out(filename, ios::binary | ios::trunc);
+            out << content;
+        }
+
+        const auto expected = StreamReferenceLines(content);
+
+        for (size_t buffer_size : {1, 7, 64, 4096, 1 << 20})
+        {
+            EXPECT_EQ(ReadAheadLines(filename, buffer_size), expected) << "buffer " << buffer_size;
+        }
+    }
+
+    remove(filename.c_str());
+}
+
+TEST(ReadAheadReaderTestCase, MissingFileTest)
+{
+    ReadAheadReader reader;
+    EXPECT_FALSE(reader.open("read_ahead_unittest_missing.txt"));
+}
+
+TEST(ReadAheadReaderTestCase, CloseBeforeEndTest)
+{
+    const string filename = "read_ahead_unittest.txt";
+
+    {
+        ofstream out(filename, ios::binary | ios::trunc);
+        out << string(100000, 'x');
+    }
+
+    ReadAheadReader reader(16);
+    ASSERT_TRUE(reader.open(filename));
+
+    string_view block;
+    ASSERT_TRUE(reader.next(block));
+    EXPECT_EQ(block.size(), 16u);
+
+    //Reading thread is blocked on the full ring, must be stopped anyway
+    reader.close();
+
+    remove(filename.c_str());
+}
@@ -116,7 +116,7 @@ TEST(SymbolOrderListTestCase, NegativePriceOrderAddTest)
 {
     SymbolOrderList order_list(DEFAULT_SHARE_NAME);
 
-    const auto negative_price = order_one.price * -1.0;
+    const auto negative_price = -order_one.price;
 
     EXPECT_THROW(order_list.add(order_one.order_id, OrderSide::BUY, order_one.quantity, negative_price),
         OrderProcessException);
@@ -139,11 +139,11 @@ TEST(SymbolOrderListTestCase, BasicOrderModifyTest)
 
     OrderRequest expected_order_buy = order_one;
     expected_order_buy.quantity += 10;
-    expected_order_buy.price += 0.02;
+    expected_order_buy.price += 200;
 
     OrderRequest expected_order_sell = order_two;
     expected_order_sell.quantity -= 10;
-    expected_order_sell.price -= 0.02;
+    expected_order_sell.price -= 200;
 
     order_list.modify(expected_order_buy.order_id, expected_order_buy.quantity, expected_order_buy.price);
     order_list.modify(expected_order_sell.order_id, expected_order_sell.quantity, expected_order_sell.price);
@@ -173,7 +173,7 @@ TEST(SymbolOrderListTestCase, NegativePriceOrderModifyTest)
 
     order_list.add(order_one.order_id, OrderSide::BUY, order_one.quantity, order_one.price);
 
-    const auto negative_price = order_one.price * -1.0;
+    const auto negative_price = -order_one.price;
 
     EXPECT_THROW(order_list.modify(order_one.order_id, order_one.quantity, negative_price),
         OrderProcessException);
@@ -244,7 +244,7 @@ TEST(SymbolOrderListTestCase, EmptyListOrderBboTest)
 
     OrderBbo actual_bbo = order_list.bbo();
 
-    OrderBbo expected_bbo(0, 0.0, 0, 0, 0.0, 0);
+    OrderBbo expected_bbo(0, 0, 0, 0, 0, 0);
 
     expected_bbo.setBuyNil(true);
     expected_bbo.setSellNil(true);
@@ -273,12 +273,12 @@ TEST(SymbolOrderListTestCase, BasicOrderVwapTest)
 
     uint64_t demanded_quantity = 125;
 
-    double total_bid_price_over_quantity =
+    Price total_bid_price_over_quantity =
         order_one.quantity * order_one.price +
         order_one_dub.quantity * order_one_dub.price +
         order_two.quantity * order_two.price;
 
-    double expected_bid_vwap = total_bid_price_over_quantity / demanded_quantity;
+    double expected_bid_vwap = static_cast<double>(total_bid_price_over_quantity) / demanded_quantity;
 
     // quantity from order_four and order_four_dub will cover the demanded_quantity
     double expected_ask_vwap = order_four.price;
@@ -310,18 +310,18 @@ TEST(SymbolOrderListTestCase, UnEvenBasicOrderVwapTest)
 
     uint64_t demanded_quantity = 130;
 
-    double total_bid_price_over_quantity =
+    Price total_bid_price_over_quantity =
         order_one.quantity * order_one.price +
         order_one_dub.quantity * order_one_dub.price +
         order_two.quantity * order_two.price + order_two_dub.price * 5;
 
-    double expected_bid_vwap = total_bid_price_over_quantity / demanded_quantity;
+    double expected_bid_vwap = static_cast<double>(total_bid_price_over_quantity) / demanded_quantity;
 
-    double total_ask_price_over_quantity =
+    Price total_ask_price_over_quantity =
         order_four.quantity * order_four.price +
         order_four.price * 30;
 
-    double expected_ask_vwap = total_ask_price_over_quantity / demanded_quantity;
+    double expected_ask_vwap = static_cast<double>(total_ask_price_over_quantity) / demanded_quantity;
 
     OrderVwap actual_vwap = order_list.vwap(demanded_quantity);
 
@@ -376,4 +376,165 @@ TEST(SymbolOrderListTestCase, ZeroQuantityOrderVwapTest)
     SymbolOrderList order_list(DEFAULT_SHARE_NAME);
 
     EXPECT_THROW(order_list.vwap(0), OrderProcessException);
-}
\ No newline at end of file
+}
+TEST(SymbolOrderListTestCase, StatusCodesTest)
+{
+    SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::BUY, 0, order_one.price), ORDER_ZERO_QUANTITY);
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::BUY, order_one.quantity, -1), ORDER_NEGATIVE_PRICE);
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::UNKNOWN, order_one.quantity, order_one.price),
+        ORDER_UNKNOWN_SIDE);
+    EXPECT_EQ(order_list.totalQuantity(), 0u);
+
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::BUY, order_one.quantity, order_one.price), ORDER_OK);
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::SELL, order_one.quantity, order_one.price),
+        ORDER_DUPLICATED);
+
+    EXPECT_EQ(order_list.tryModify(order_two.order_id, order_two.quantity, order_two.price), ORDER_NOT_FOUND);
+    EXPECT_EQ(order_list.tryModify(order_one.order_id, 0, order_one.price), ORDER_ZERO_QUANTITY);
+    EXPECT_EQ(order_list.tryModify(order_one.order_id, order_two.quantity, order_two.price), ORDER_OK);
+    EXPECT_EQ(order_list.totalQuantity(), order_two.quantity);
+
+    EXPECT_EQ(order_list.tryCancel(order_two.order_id), ORDER_NOT_FOUND);
+    EXPECT_EQ(order_list.tryCancel(order_one.order_id), ORDER_OK);
+    EXPECT_EQ(order_list.tryCancel(order_one.order_id), ORDER_NOT_FOUND);
+    EXPECT_EQ(order_list.totalQuantity(), 0u);
+}
+
+TEST(SymbolOrderListTestCase, StatusMessageTest)
+{
+    EXPECT_EQ(OrderStatusMessage(ORDER_ZERO_QUANTITY, 7), "For order_id [7] quantity is zero");
+    EXPECT_EQ(OrderStatusMessage(ORDER_NEGATIVE_PRICE, 7), "For order_id [7] price is negative");
+    EXPECT_EQ(OrderStatusMessage(ORDER_UNKNOWN_SIDE, 7), "For order_id [7] side is unknown");
+    EXPECT_EQ(OrderStatusMessage(ORDER_DUPLICATED, 7), "Dublicated order_id [7]");
+    EXPECT_EQ(OrderStatusMessage(ORDER_NOT_FOUND, 7), "No such order_id [7]");
+
+    SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+
+    try
+    {
+        order_list.cancel(order_one.order_id);
+        FAIL() << "OrderProcessException expected";
+    }
+    catch (OrderProcessException &e)
+    {
+        EXPECT_EQ(string(e.what()), OrderStatusMessage(ORDER_NOT_FOUND, order_one.order_id));
+    }
+}
+
+TEST(SymbolOrderListTestCase, HandleTest)
+{
+    SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+    OrderHandle handle_one{NO_ORDER, 0, OrderSide::UNKNOWN}, handle_two{NO_ORDER, 0, OrderSide::UNKNOWN};
+
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::UNKNOWN, order_one.quantity, order_one.price,
+                                handle_one), ORDER_UNKNOWN_SIDE);
+    EXPECT_EQ(handle_one.order, NO_ORDER);
+
+    EXPECT_EQ(order_list.tryAdd(order_one.order_id, OrderSide::BUY, order_one.quantity, order_one.price,
+                                handle_one), ORDER_OK);
+    EXPECT_EQ(order_list.tryAdd(order_two.order_id, OrderSide::SELL, order_two.quantity, order_two.price,
+                                handle_two), ORDER_OK);
+
+    EXPECT_NE(handle_one.order, NO_ORDER);
+    EXPECT_EQ(handle_one.side, OrderSide::BUY);
+    EXPECT_EQ(order_list.order(handle_one.side, handle_one.order).order_id, order_one.order_id);
+    EXPECT_EQ(order_list.totalQuantity(), order_one.quantity + order_two.quantity);
+
+    //Handle orders are not in the id map
+    EXPECT_EQ(order_list.tryCancel(order_one.order_id), ORDER_NOT_FOUND);
+
+    EXPECT_EQ(order_list.tryModify(handle_one, 0, order_one.price), ORDER_ZERO_QUANTITY);
+    EXPECT_EQ(order_list.tryModify(handle_one, order_three.quantity, order_three.price), ORDER_OK);
+    EXPECT_EQ(order_list.order(handle_one.side, handle_one.order).order_id, order_one.order_id);
+    EXPECT_EQ(order_list.order(handle_one.side, handle_one.order).price, order_three.price);
+    EXPECT_EQ(order_list.totalQuantity(), order_three.quantity + order_two.quantity);
+
+    auto bbo = order_list.bbo();
+    EXPECT_EQ(bbo.getBuySharePrice(), order_three.price);
+    EXPECT_EQ(bbo.getSellSharePrice(), order_two.price);
+
+    order_list.cancel(handle_one);
+    order_list.cancel(handle_two);
+    EXPECT_EQ(order_list.totalQuantity(), 0u);
+}
+
+TEST(SymbolOrderListTestCase, BboChangedTest)
+{
+    SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+
+    EXPECT_FALSE(order_list.bboChanged());
+
+    order_list.add(order_one.order_id, OrderSide::BUY, order_one.quantity, order_one.price);
+    EXPECT_TRUE(order_list.bboChanged());
+    OrderBbo bbo = order_list.bbo();
+    EXPECT_EQ(bbo.getBuySharePrice(), order_one.price);
+
+    //Worse price does not touch the BBO
+    order_list.resetBboChanged();
+    order_list.add(order_two.order_id, OrderSide::BUY, order_two.quantity, order_two.price);
+    order_list.cancel(order_two.order_id);
+    EXPECT_FALSE(order_list.bboChanged());
+
+    //Same price adds the volume
+    order_list.add(order_one_dub.order_id, OrderSide::BUY, order_one_dub.quantity, order_one_dub.price);
+    EXPECT_TRUE(order_list.bboChanged());
+    bbo = order_list.bbo();
+    EXPECT_EQ(bbo.getBuyTotalVolume(), order_one.quantity + order_one_dub.quantity);
+    EXPECT_EQ(bbo.getBuyOrderCount(), 2u);
+
+    //Failed operation does not touch the BBO
+    order_list.resetBboChanged();
+    EXPECT_EQ(order_list.tryCancel(order_two.order_id), ORDER_NOT_FOUND);
+    EXPECT_FALSE(order_list.bboChanged());
+
+    order_list.cancel(order_one.order_id);
+    order_list.cancel(order_one_dub.order_id);
+    EXPECT_TRUE(order_list.bboChanged());
+
+    stringstream actual, expected;
+    actual << order_list.bbo();
+    expected << OrderBbo();
+    EXPECT_EQ(actual.str(), expected.str());
+    EXPECT_EQ(order_list.bbo(), OrderBbo());
+}
+
+TEST(SymbolOrderListTestCase, ModifyPriorityTest)
+{
+    auto FirstOrderAfter = [](ModifyPriority priority, uint64_t quantity, Price price)
+    {
+        SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+        order_list.setModifyPriority(priority);
+
+        order_list.add(order_one.order_id, OrderSide::SELL, order_one.quantity, order_one.price);
+        order_list.add(order_one_dub.order_id, OrderSide::SELL, order_one_dub.quantity, order_one_dub.price);
+        order_list.modify(order_one.order_id, quantity, price);
+
+        EXPECT_EQ(order_list.totalQuantity(), quantity + order_one_dub.quantity);
+
+        return order_list.asks().orders().orderId(order_list.asks().best().head);
+    };
+
+    const uint64_t size_down = order_one.quantity - 1;
+    const uint64_t size_up = order_one.quantity + 1;
+
+    EXPECT_EQ(FirstOrderAfter(MODIFY_REQUEUE, size_down, order_one.price), order_one_dub.order_id);
+    EXPECT_EQ(FirstOrderAfter(MODIFY_REQUEUE, order_one.quantity, order_one.price), order_one_dub.order_id);
+
+    EXPECT_EQ(FirstOrderAfter(MODIFY_KEEP_ON_SIZE_DOWN, size_down, order_one.price), order_one.order_id);
+    EXPECT_EQ(FirstOrderAfter(MODIFY_KEEP_ON_SIZE_DOWN, size_up, order_one.price), order_one_dub.order_id);
+
+    EXPECT_EQ(FirstOrderAfter(MODIFY_KEEP_ON_SAME_PRICE, size_up, order_one.price), order_one.order_id);
+
+    //Price change always loses the place
+    SymbolOrderList order_list(DEFAULT_SHARE_NAME);
+    order_list.setModifyPriority(MODIFY_KEEP_ON_SAME_PRICE);
+
+    order_list.add(order_one.order_id, OrderSide::SELL, order_one.quantity, order_one.price);
+    order_list.add(order_one_dub.order_id, OrderSide::SELL, order_one_dub.quantity, order_one_dub.price);
+    order_list.modify(order_one.order_id, size_down, order_two.price);
+    order_list.modify(order_one.order_id, size_down, order_one.price);
+
+    EXPECT_EQ(order_list.asks().orders().orderId(order_list.asks().best().head), order_one_dub.order_id);
+}
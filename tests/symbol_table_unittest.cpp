@@ -0,0 +1,97 @@
+//
+//  symbol_table_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 12.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <string>
+
+//Local includes
+#include "symbol_table.hpp"
+#include "md_processor.hpp"
+#include "order_registry.hpp"
+
+using namespace std;
+using namespace md::processors;
+
+/************************** SymbolTableTestCase ***********************/
+
+TEST(SymbolTableTestCase, InternTest)
+{
+    SymbolTable symbols;
+
+    EXPECT_EQ(symbols.size(), 0u);
+    EXPECT_EQ(symbols.find("AAPL"), INVALID_SYMBOL_ID);
+
+    const SymbolId aapl = symbols.intern("AAPL");
+    const SymbolId msft = symbols.intern("MSFT");
+    const SymbolId longer = symbols.intern("VERY.LONG.SYMBOL");
+
+    EXPECT_EQ(aapl, 0u);
+    EXPECT_EQ(msft, 1u);
+    EXPECT_EQ(longer, 2u);
+
+    EXPECT_EQ(symbols.intern("AAPL"), aapl);
+    EXPECT_EQ(symbols.intern(string("VERY.LONG.SYMBOL")), longer);
+    EXPECT_EQ(symbols.find("MSFT"), msft);
+    EXPECT_EQ(symbols.find("VERY.LONG.SYMBO"), INVALID_SYMBOL_ID);
+    EXPECT_EQ(symbols.size(), 3u);
+
+    EXPECT_EQ(symbols.name(aapl), "AAPL");
+    EXPECT_EQ(symbols.name(longer), "VERY.LONG.SYMBOL");
+}
+
+TEST(SymbolTableTestCase, PackedKeyTest)
+{
+    SymbolTable symbols;
+
+    //Same bytes, different length
+    const SymbolId one = symbols.intern(string_view("A", 1));
+    const SymbolId two = symbols.intern(string_view("A\0", 2));
+    const SymbolId empty = symbols.intern("");
+
+    EXPECT_NE(one, two);
+    EXPECT_NE(one, empty);
+    EXPECT_NE(two, empty);
+
+    //Longest packed and shortest not packed symbols
+    const SymbolId seven = symbols.intern("ABCDEFG");
+    const SymbolId eight = symbols.intern("ABCDEFGH");
+
+    EXPECT_NE(seven, eight);
+    EXPECT_EQ(symbols.find("ABCDEFG"), seven);
+    EXPECT_EQ(symbols.find("ABCDEFGH"), eight);
+    EXPECT_EQ(symbols.name(two), string("A\0", 2));
+}
+
+TEST(SymbolTableTestCase, RegistryTest)
+{
+    MdProcessor processor;
+    auto &registry = processor.getRegistry();
+
+    EXPECT_TRUE(processor.orderAdd(70000001, "INTERNED", OrderSide::BUY, 1, PRICE_SCALE));
+
+    const SymbolId symbol_id = registry.getSymbols().find("INTERNED");
+    ASSERT_NE(symbol_id, INVALID_SYMBOL_ID);
+    ASSERT_NE(registry.getOrdersActive().find(70000001), nullptr);
+    EXPECT_EQ(registry.getOrdersActive().find(70000001)->symbol, symbol_id);
+    ASSERT_NE(registry.findOrderList(symbol_id), nullptr);
+    EXPECT_EQ(registry.findOrderList(symbol_id)->symbol(), "INTERNED");
+    EXPECT_EQ(registry.findOrderList(INVALID_SYMBOL_ID), nullptr);
+
+    //Never subscribed symbol
+    EXPECT_FALSE(processor.unsubscribeBbo("NOT.INTERNED"));
+    EXPECT_FALSE(processor.unsubscribeVwap("NOT.INTERNED", 10));
+    EXPECT_EQ(registry.getSymbols().find("NOT.INTERNED"), INVALID_SYMBOL_ID);
+
+    EXPECT_TRUE(processor.subscribeBbo("INTERNED"));
+    EXPECT_TRUE(processor.unsubscribeBbo("INTERNED"));
+    EXPECT_TRUE(processor.unsubscribeBbo("INTERNED"));
+
+    EXPECT_TRUE(processor.orderCancel(70000001));
+    EXPECT_FALSE(registry.getOrdersActive().contains(70000001));
+}
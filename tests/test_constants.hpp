@@ -21,18 +21,18 @@ using namespace std;
 
 const uint64_t DEFAULT_ORDER_ID = 100;
 const uint64_t DEFAULT_QUANTITY = 10;
-const double DEFAULT_PRICE = 72.82;
+const Price DEFAULT_PRICE = 728200;
 const string DEFAULT_SHARE_NAME = "AAPL";
 const uint64_t DEFAULT_VWAP_QUANTITY = 5;
 
-const OrderRequest order_one       = {100, 10, 72.82};
-const OrderRequest order_one_dub   = {200, 15, 72.82};
-const OrderRequest order_two       = {101, 100, 72.81};
-const OrderRequest order_two_dub   = {201, 125, 72.81};
-const OrderRequest order_three     = {102, 100, 72.79};
-const OrderRequest order_three_dub = {202, 125, 72.79};
-const OrderRequest order_four      = {103, 100, 72.78};
-const OrderRequest order_four_dub  = {203, 125, 72.78};
+const OrderRequest order_one       = {100, 10, 728200};
+const OrderRequest order_one_dub   = {200, 15, 728200};
+const OrderRequest order_two       = {101, 100, 728100};
+const OrderRequest order_two_dub   = {201, 125, 728100};
+const OrderRequest order_three     = {102, 100, 727900};
+const OrderRequest order_three_dub = {202, 125, 727900};
+const OrderRequest order_four      = {103, 100, 727800};
+const OrderRequest order_four_dub  = {203, 125, 727800};
 
 const int default_width = 10;
 const int default_precision = 2;
@@ -0,0 +1,83 @@
+//
+//  tokenizer_unittest.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 04.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+//Local includes
+#include "tokenizer.hpp"
+#include "split.hpp"
+
+using namespace std;
+using namespace md::tokenizers;
+
+/******************************* Helpers ******************************/
+
+vector<string> ToVector(const TokenList &tokens)
+{
+    vector<string> result;
+
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        result.emplace_back(tokens[i]);
+    }
+
+    return result;
+}
+
+/************************** TokenizerTestCase *************************/
+
+TEST(TokenizerTestCase, SameAsSplitTest)
+{
+    vector<string> lines =
+        {
+            "ORDER ADD,1000,AAPL,Buy,10,72.82",
+            "ORDER ADD,,,,,",
+            ",1000,AAPL,Buy,10,72.82",
+            "ORDER CANCEL,1000,",
+            ",,,",
+            "PRINT",
+            ""
+        };
+
+    TokenList tokens;
+
+    for (const auto &line : lines)
+    {
+        Tokenize(line, ',', tokens);
+        EXPECT_EQ(ToVector(tokens), split(line, ','));
+    }
+}
+
+TEST(TokenizerTestCase, ReuseTest)
+{
+    TokenList tokens;
+
+    Tokenize("ORDER ADD,1000,AAPL,Buy,10,72.82", ',', tokens);
+    EXPECT_EQ(tokens.size(), 6u);
+
+    Tokenize("PRINT,AAPL", ',', tokens);
+    ASSERT_EQ(tokens.size(), 2u);
+    EXPECT_EQ(tokens[0], "PRINT");
+    EXPECT_EQ(tokens[1], "AAPL");
+
+    Tokenize("", ',', tokens);
+    EXPECT_TRUE(tokens.empty());
+}
+
+TEST(TokenizerTestCase, OverCapacityTest)
+{
+    TokenList tokens;
+
+    Tokenize("1,2,3,4,5,6,7,8,9,10", ',', tokens);
+
+    EXPECT_EQ(tokens.size(), 10u);
+    EXPECT_EQ(tokens[TokenList::CAPACITY - 1], "8");
+}
@@ -0,0 +1,159 @@
+//
+//  md_convert.cpp
+//  market_data_replay
+//
+//  Created by Fedor Lisochenko on 07.02.2018.
+//  Copyright © 2018 Fedor Lisochenko. All rights reserved.
+//
+
+//System includes
+#include <stdlib.h>
+#include <iostream>
+#include <fstream>
+
+//Local includes
+#include "binary_codec.hpp"
+#include "mapped_file.hpp"
+#include "delimiter_scanner.hpp"
+
+using namespace std;
+using namespace md::binary;
+using md::tokenizers::TokenList;
+
+/******************************* Helpers ******************************/
+
+namespace
+{
+
+/** Is used to convert the lines one by one and count the results */
+class LineConverter
+{
+public:
+    /**
+     * Constructor
+     * @param writer where to write the records
+     */
+    explicit LineConverter(BinaryWriter &writer) :
+        writer_(writer),
+        decoder_(false),
+        skipped_(0)
+    {
+    }
+
+    /**
+     * Is used to convert one line. Lines which can't be converted are reported
+     * and skipped
+     * @param line original text
+     * @param tokens of the line
+     */
+    void convert(string_view line, const TokenList &tokens)
+    {
+        if (EncodeTokens(tokens, decoder_, writer_, record_))
+        {
+            writer_.write(record_);
+        }
+        else
+        {
+            cerr << "Skipped line: [" << line << "]" << '\n';
+            ++skipped_;
+        }
+    }
+
+    /**
+     * Is used to get the number of the lines which were not converted
+     * @return number of the lines
+     */
+    uint64_t skipped() const
+    {
+        return skipped_;
+    }
+
+private:
+    /** Output */
+    BinaryWriter &writer_;
+
+    /** Validates the lines. Reports the numeric failures */
+    MdDecoder decoder_;
+
+    /** Is reused for every line */
+    BinaryRecord record_;
+
+    /** Number of the lines which were not converted */
+    uint64_t skipped_;
+};
+
+} // namespace
+
+/**************************** Entry point *****************************/
+
+/** Program entry point */
+int main(int argc, const char * argv[])
+{
+    if (argc < 3)
+    {
+        cerr << "Usage: md_convert <text file> <binary file>" << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    const string input = argv[1];
+    const string output = argv[2];
+
+    BinaryWriter writer;
+
+    if (!writer.open(output))
+    {
+        cerr << "failed to create " << output << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    LineConverter converter(writer);
+    md::readers::MappedFile mapped;
+
+    if (mapped.open(input))
+    {
+        md::tokenizers::BlockTokenizer tokenizer;
+
+        tokenizer.forEachLine(mapped.view(), [&converter](string_view line, const TokenList &tokens)
+        {
+            converter.convert(line, tokens);
+        });
+    }
+    else
+    {
+        //Can't be mapped (pipe, device, etc.). Fall back to the stream reading
+        ifstream infs(input);
+
+        if (!infs.is_open())
+        {
+            cerr << "failed to open " << input << '\n';
+            exit(EXIT_FAILURE);
+        }
+
+        TokenList tokens;
+
+        for (string line; getline( infs, line ); )
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+
+            md::tokenizers::Tokenize(line, ',', tokens);
+            converter.convert(line, tokens);
+        }
+    }
+
+    const uint64_t records = writer.recordCount();
+    const size_t symbols = writer.symbolCount();
+
+    if (!writer.close())
+    {
+        cerr << "failed to write " << output << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    cout << "Converted " << records << " records, " << symbols << " symbols, skipped "
+        << converter.skipped() << " lines" << '\n';
+
+    exit(EXIT_SUCCESS);
+}